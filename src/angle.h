@@ -1,6 +1,13 @@
 #ifndef UNITIZED_ANGLE_H
 #define UNITIZED_ANGLE_H
 
+#include "unitizedglobal.h"
+#include "unitnames.h"
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
 namespace unitized {
 
 class Angle
@@ -14,64 +21,142 @@ public:
         PercentGrade = 5
     };
 
-    Angle(double value, Unit unit);
-
-    static Angle degrees(double value);
-    static Angle gradians(double value);
-    static Angle radians(double value);
-    static Angle milsNATO(double value);
-    static Angle percentGrade(double value);
-
-    static double sin(Angle angle);
-    static double cos(Angle angle);
-    static double tan(Angle angle);
-    static Angle asin(double value);
-    static Angle acos(double value);
-    static Angle atan(double value);
-    static Angle atan2(double y, double x);
-
-    double convertTo(Unit unit) const;
-    double toDegrees() const;
-    double toGradians() const;
-    double toRadians() const;
-    double toMilsNATO() const;
-    double toPercentGrade() const;
-
-    Angle as(Unit unit) const;
-    Angle asDegrees() const;
-    Angle asGradians() const;
-    Angle asRadians() const;
-    Angle asMilsNATO() const;
-    Angle asPercentGrade() const;
-
-    Angle add(Angle addend) const;
-    Angle sub(Angle subtrahend) const;
-    Angle mul(double multiplicand) const;
-    Angle div(double denominator) const;
-    double divUnitless(Angle denominator) const;
-    Angle mod(Angle modulus) const;
-    Angle abs() const;
-    Angle negate() const;
-    bool isFinite() const;
-    bool isInfinite() const;
-    bool isNaN() const;
-    bool isNegative() const;
-    bool isPositive() const;
-    bool isZero() const;
-    bool isNonzero() const;
-    bool equals(Angle other) const;
-    int compareTo(Angle other) const;
-
-    const Unit unit;
+    // Converts values from one unit to another with the factor (or the
+    // PercentGrade function) resolved once, for converting whole columns of
+    // values.
+    class Converter
+    {
+    public:
+        UNITIZED_CONSTEXPR Converter(Unit from, Unit to) noexcept;
+
+        UNITIZED_CONSTEXPR double operator()(double value) const noexcept;
+        // out may be the same array as in.
+        UNITIZED_INLINE void apply(const double* in, double* out, std::size_t n) const noexcept;
+
+    private:
+        enum Kind {
+            Linear,
+            ToPercentGrade,
+            FromPercentGrade
+        };
+
+        Kind kind;
+        double factor;
+    };
+
+    UNITIZED_CONSTEXPR Angle(double value, Unit unit) noexcept;
+
+    static UNITIZED_CONSTEXPR Angle degrees(double value) noexcept;
+    static UNITIZED_CONSTEXPR Angle gradians(double value) noexcept;
+    static UNITIZED_CONSTEXPR Angle radians(double value) noexcept;
+    static UNITIZED_CONSTEXPR Angle milsNATO(double value) noexcept;
+    static UNITIZED_CONSTEXPR Angle percentGrade(double value) noexcept;
+
+    // The unit with the given symbol, abbreviation or name in any ASCII case
+    // ("deg", "DEG", "grad", "mils", ...), or Unit(0) if there is none.
+    static UNITIZED_CONSTEXPR Unit parseUnit(std::string_view name) noexcept;
+
+    static UNITIZED_INLINE double sin(Angle angle) noexcept;
+    static UNITIZED_INLINE double cos(Angle angle) noexcept;
+    static UNITIZED_INLINE double tan(Angle angle) noexcept;
+    // Both sin and cos from one conversion and range reduction.
+    static UNITIZED_INLINE void sincos(Angle angle, double& sin, double& cos) noexcept;
+    static UNITIZED_INLINE Angle asin(double value) noexcept;
+    static UNITIZED_INLINE Angle acos(double value) noexcept;
+    static UNITIZED_INLINE Angle atan(double value) noexcept;
+    static UNITIZED_INLINE Angle atan2(double y, double x) noexcept;
+
+    UNITIZED_CONSTEXPR double convertTo(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR double toDegrees() const noexcept;
+    UNITIZED_CONSTEXPR double toGradians() const noexcept;
+    UNITIZED_CONSTEXPR double toRadians() const noexcept;
+    UNITIZED_CONSTEXPR double toMilsNATO() const noexcept;
+    UNITIZED_CONSTEXPR double toPercentGrade() const noexcept;
+
+    UNITIZED_CONSTEXPR Angle as(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR Angle asDegrees() const noexcept;
+    UNITIZED_CONSTEXPR Angle asGradians() const noexcept;
+    UNITIZED_CONSTEXPR Angle asRadians() const noexcept;
+    UNITIZED_CONSTEXPR Angle asMilsNATO() const noexcept;
+    UNITIZED_CONSTEXPR Angle asPercentGrade() const noexcept;
+
+    UNITIZED_CONSTEXPR Angle add(Angle addend) const noexcept;
+    UNITIZED_CONSTEXPR Angle sub(Angle subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR Angle mul(double multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR Angle div(double denominator) const noexcept;
+    UNITIZED_CONSTEXPR double divUnitless(Angle denominator) const noexcept;
+    UNITIZED_INLINE Angle mod(Angle modulus) const noexcept;
+    UNITIZED_INLINE Angle abs() const noexcept;
+    UNITIZED_CONSTEXPR Angle negate() const noexcept;
+    UNITIZED_INLINE bool isFinite() const noexcept;
+    UNITIZED_INLINE bool isInfinite() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isNegative() const noexcept;
+    UNITIZED_CONSTEXPR bool isPositive() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool isNonzero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(Angle other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(Angle other) const noexcept;
+
+    // Not const, so that Angles can be assigned, swapped and sorted in place.
+    Unit unit;
 
 private:
-    const double value;
+    double value;
+
+    // M_PI is not standard C++, so keep our own.
+    static constexpr double Pi = 3.14159265358979323846;
+
+    // Factors[from][to] converts between the linear units with a single
+    // multiply.  Unit starts at 1, so row and column 0 are NaN, like every
+    // conversion of a unit that doesn't exist.  PercentGrade is nonlinear, so
+    // convert() handles it separately.
+    static constexpr double Factors[PercentGrade + 1][PercentGrade + 1] = {
+        {NAN, NAN, NAN, NAN, NAN, NAN},
+        // to: Degrees, Gradians, Radians, MilsNATO, PercentGrade
+        /* Degrees */ {NAN, 1, 400.0 / 360, Pi / 180, 6400.0 / 360, 0},
+        /* Gradians */ {NAN, 360.0 / 400, 1, Pi / 200, 6400.0 / 400, 0},
+        /* Radians */ {NAN, 180 / Pi, 200 / Pi, 1, 3200 / Pi, 0},
+        /* MilsNATO */ {NAN, 360.0 / 6400, 400.0 / 6400, Pi / 3200, 1, 0},
+        /* PercentGrade */ {NAN, 0, 0, 0, 0, 1}
+    };
+    // Factors[from][to], or NaN if either unit is out of range.
+    static constexpr double conversionFactor(Unit from, Unit to) noexcept {
+        return static_cast<unsigned>(from) <= PercentGrade && static_cast<unsigned>(to) <= PercentGrade ?
+            Factors[from][to] : NAN;
+    }
+
+    // Units per right angle for the units trigonometry can reduce exactly in
+    // (see simd::nativeSin), or 0.
+    static constexpr double RightAngles[PercentGrade + 1] = {0, 90, 100, 0, 1600, 0};
 
-    static double convert(double value, Unit from, Unit to);
-    static double fromBase(double value, Unit to);
-    static double toBase(double value, Unit from);
+    // Everything parseUnit accepts, in lower case.
+    static constexpr detail::UnitName UnitNames[] = {
+        {"\xc2\xb0", Degrees}, {"%", PercentGrade},
+        {"d", Degrees}, {"deg", Degrees}, {"degree", Degrees}, {"degrees", Degrees},
+        {"grad", Gradians}, {"grads", Gradians}, {"gradian", Gradians}, {"gradians", Gradians}, {"gon", Gradians},
+        {"rad", Radians}, {"radian", Radians}, {"radians", Radians},
+        {"mil", MilsNATO}, {"mils", MilsNATO},
+        {"percent", PercentGrade}, {"pct", PercentGrade}
+    };
+    static constexpr detail::UnitNameTable<sizeof(UnitNames) / sizeof(UnitNames[0])> UnitNameLookup{UnitNames, 2};
+    static_assert(UnitNameLookup.perfect, "UnitNames collide; search for a new seed");
+
+    static UNITIZED_CONSTEXPR double convert(double value, Unit from, Unit to) noexcept;
+
+    friend class AngleArray;
+    friend class AngleF;
+    friend class Traverse;
+    friend struct AngleDimension;
 };
 
+// Angles can be copied with memcpy and held in std::atomic.
+static_assert(std::is_trivially_copyable<Angle>::value, "Angle must be trivially copyable");
+
 } // namespace unitized
 
+#ifdef UNITIZED_HEADER_ONLY
+#include "angle.inl"
+#endif
+
 #endif // UNITIZED_ANGLE_H
@@ -0,0 +1,190 @@
+#include "simd.h"
+#include <cmath>
+
+namespace unitized {
+
+UNITIZED_CONSTEXPR Angle::Converter::Converter(Unit from, Unit to) noexcept:
+    kind(from == to ? Linear : to == PercentGrade ? ToPercentGrade : from == PercentGrade ? FromPercentGrade : Linear),
+    factor(kind == ToPercentGrade ? conversionFactor(from, Radians) :
+           kind == FromPercentGrade ? conversionFactor(Radians, to) : conversionFactor(from, to)) {}
+
+UNITIZED_CONSTEXPR double Angle::Converter::operator()(double value) const noexcept {
+    switch (kind) {
+    case ToPercentGrade: return std::tan(value * factor) * 100;
+    case FromPercentGrade: return std::atan(value * 0.01) * factor;
+    default: return value * factor;
+    }
+}
+UNITIZED_INLINE void Angle::Converter::apply(const double* in, double* out, std::size_t n) const noexcept {
+    switch (kind) {
+    case ToPercentGrade:
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = std::tan(in[i] * factor) * 100;
+        }
+        break;
+    case FromPercentGrade:
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = std::atan(in[i] * 0.01) * factor;
+        }
+        break;
+    default:
+        simd::kernels().scale(in, out, n, factor);
+        break;
+    }
+}
+
+UNITIZED_CONSTEXPR Angle::Angle(double value, Unit unit) noexcept: unit(unit), value(value) {}
+
+UNITIZED_CONSTEXPR Angle Angle::degrees(double value) noexcept {
+    return Angle(value, Angle::Degrees);
+}
+UNITIZED_CONSTEXPR Angle Angle::gradians(double value) noexcept {
+    return Angle(value, Angle::Gradians);
+}
+UNITIZED_CONSTEXPR Angle Angle::radians(double value) noexcept {
+    return Angle(value, Angle::Radians);
+}
+UNITIZED_CONSTEXPR Angle Angle::milsNATO(double value) noexcept {
+    return Angle(value, Angle::MilsNATO);
+}
+UNITIZED_CONSTEXPR Angle Angle::percentGrade(double value) noexcept {
+    return Angle(value, Angle::PercentGrade);
+}
+
+UNITIZED_CONSTEXPR Angle::Unit Angle::parseUnit(std::string_view name) noexcept {
+    return static_cast<Unit>(UnitNameLookup.find(name));
+}
+
+UNITIZED_INLINE double Angle::sin(Angle angle) noexcept {
+    double rightAngle = RightAngles[angle.unit];
+    return rightAngle ? simd::nativeSin(angle.value, rightAngle) : std::sin(angle.toRadians());
+}
+UNITIZED_INLINE double Angle::cos(Angle angle) noexcept {
+    double rightAngle = RightAngles[angle.unit];
+    return rightAngle ? simd::nativeCos(angle.value, rightAngle) : std::cos(angle.toRadians());
+}
+UNITIZED_INLINE double Angle::tan(Angle angle) noexcept {
+    double rightAngle = RightAngles[angle.unit];
+    return rightAngle ? simd::nativeTan(angle.value, rightAngle) : std::tan(angle.toRadians());
+}
+UNITIZED_INLINE void Angle::sincos(Angle angle, double& sin, double& cos) noexcept {
+    double rightAngle = RightAngles[angle.unit];
+    if (rightAngle) {
+        simd::nativeSincos(angle.value, rightAngle, sin, cos);
+    } else {
+        simd::sincos(angle.toRadians(), sin, cos);
+    }
+}
+UNITIZED_INLINE Angle Angle::asin(double value) noexcept {
+    return Angle::radians(std::asin(value));
+}
+UNITIZED_INLINE Angle Angle::acos(double value) noexcept {
+    return Angle::radians(std::acos(value));
+}
+UNITIZED_INLINE Angle Angle::atan(double value) noexcept {
+    return Angle::radians(std::atan(value));
+}
+UNITIZED_INLINE Angle Angle::atan2(double y, double x) noexcept {
+    return Angle::radians(std::atan2(y, x));
+}
+
+UNITIZED_CONSTEXPR double Angle::convertTo(Unit unit) const noexcept {
+    return convert(value, Angle::unit, unit);
+}
+UNITIZED_CONSTEXPR double Angle::toDegrees() const noexcept {
+    return convertTo(Angle::Degrees);
+}
+UNITIZED_CONSTEXPR double Angle::toGradians() const noexcept {
+    return convertTo(Angle::Gradians);
+}
+UNITIZED_CONSTEXPR double Angle::toRadians() const noexcept {
+    return convertTo(Angle::Radians);
+}
+UNITIZED_CONSTEXPR double Angle::toMilsNATO() const noexcept {
+    return convertTo(Angle::MilsNATO);
+}
+UNITIZED_CONSTEXPR double Angle::toPercentGrade() const noexcept {
+    return convertTo(Angle::PercentGrade);
+}
+
+UNITIZED_CONSTEXPR Angle Angle::as(Unit unit) const noexcept {
+    return Angle(convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Angle Angle::asDegrees() const noexcept {
+    return as(Angle::Degrees);
+}
+UNITIZED_CONSTEXPR Angle Angle::asGradians() const noexcept {
+    return as(Angle::Gradians);
+}
+UNITIZED_CONSTEXPR Angle Angle::asRadians() const noexcept {
+    return as(Angle::Radians);
+}
+UNITIZED_CONSTEXPR Angle Angle::asMilsNATO() const noexcept {
+    return as(Angle::MilsNATO);
+}
+UNITIZED_CONSTEXPR Angle Angle::asPercentGrade() const noexcept {
+    return as(Angle::PercentGrade);
+}
+
+UNITIZED_CONSTEXPR Angle Angle::add(Angle addend) const noexcept {
+    return Angle(value + addend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Angle Angle::sub(Angle subtrahend) const noexcept {
+    return Angle(value - subtrahend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Angle Angle::mul(double multiplicand) const noexcept {
+    return Angle(value * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR Angle Angle::div(double denominator) const noexcept {
+    return Angle(value / denominator, unit);
+}
+UNITIZED_CONSTEXPR double Angle::divUnitless(Angle denominator) const noexcept {
+    return value / denominator.convertTo(unit);
+}
+UNITIZED_INLINE Angle Angle::mod(Angle modulus) const noexcept {
+    return Angle(std::fmod(value, modulus.convertTo(unit)), unit);
+}
+
+UNITIZED_INLINE Angle Angle::abs() const noexcept {
+    return Angle(std::fabs(value), unit);
+}
+UNITIZED_CONSTEXPR Angle Angle::negate() const noexcept {
+    return Angle(-value, unit);
+}
+
+UNITIZED_INLINE bool Angle::isFinite() const noexcept {
+    return std::isfinite(value);
+}
+UNITIZED_INLINE bool Angle::isInfinite() const noexcept {
+    return std::isinf(value);
+}
+UNITIZED_INLINE bool Angle::isNaN() const noexcept {
+    return std::isnan(value);
+}
+UNITIZED_CONSTEXPR bool Angle::isNegative() const noexcept {
+    return value < 0;
+}
+UNITIZED_CONSTEXPR bool Angle::isPositive() const noexcept {
+    return value > 0;
+}
+UNITIZED_CONSTEXPR bool Angle::isZero() const noexcept {
+    return value == 0;
+}
+UNITIZED_CONSTEXPR bool Angle::isNonzero() const noexcept {
+    return value != 0;
+}
+
+UNITIZED_CONSTEXPR bool Angle::equals(Angle other) const noexcept {
+    return value == other.convertTo(unit);
+}
+
+UNITIZED_CONSTEXPR int Angle::compareTo(Angle other) const noexcept {
+    double otherValue = other.convertTo(unit);
+    return value > otherValue ? 1 : value < otherValue ? -1 : 0;
+}
+
+UNITIZED_CONSTEXPR double Angle::convert(double value, Unit from, Unit to) noexcept {
+    return Converter(from, to)(value);
+}
+
+} // namespace unitized
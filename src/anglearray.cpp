@@ -0,0 +1,5 @@
+#include "anglearray.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "anglearray.inl"
+#endif
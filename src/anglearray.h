@@ -0,0 +1,87 @@
+#ifndef UNITIZED_ANGLEARRAY_H
+#define UNITIZED_ANGLEARRAY_H
+
+#include "unitizedglobal.h"
+#include "angle.h"
+#include "threadpool.h"
+#include <cstddef>
+#include <vector>
+
+namespace unitized {
+
+// A column of angles that all share one unit, stored as a contiguous array
+// of doubles.  Binary operations convert the other column into this column's
+// unit and require both columns to have the same size.
+class AngleArray
+{
+public:
+    UNITIZED_INLINE explicit AngleArray(Angle::Unit unit);
+    UNITIZED_INLINE AngleArray(std::size_t size, Angle::Unit unit);
+    UNITIZED_INLINE AngleArray(std::vector<double> values, Angle::Unit unit);
+
+    UNITIZED_INLINE Angle::Unit unit() const noexcept;
+    UNITIZED_INLINE std::size_t size() const noexcept;
+    UNITIZED_INLINE bool empty() const noexcept;
+    UNITIZED_INLINE const double* data() const noexcept;
+    UNITIZED_INLINE double* data() noexcept;
+
+    UNITIZED_INLINE Angle operator[](std::size_t index) const noexcept;
+    UNITIZED_INLINE void set(std::size_t index, Angle value) noexcept;
+    UNITIZED_INLINE void push_back(Angle value);
+    UNITIZED_INLINE void reserve(std::size_t capacity);
+    UNITIZED_INLINE void resize(std::size_t size);
+    UNITIZED_INLINE void clear() noexcept;
+
+    UNITIZED_INLINE void convertTo(Angle::Unit unit, double* out) const noexcept;
+    UNITIZED_INLINE void convertTo(Angle::Unit unit, double* out, const ExecutionPolicy& policy) const;
+    UNITIZED_INLINE std::vector<double> convertTo(Angle::Unit unit) const;
+    UNITIZED_INLINE AngleArray as(Angle::Unit unit) const;
+
+    UNITIZED_INLINE AngleArray add(const AngleArray& addend) const;
+    UNITIZED_INLINE AngleArray sub(const AngleArray& subtrahend) const;
+    UNITIZED_INLINE AngleArray mul(double multiplicand) const;
+    UNITIZED_INLINE AngleArray div(double denominator) const;
+    UNITIZED_INLINE bool equals(const AngleArray& other) const noexcept;
+    UNITIZED_INLINE std::vector<int> compareTo(const AngleArray& other) const;
+
+    // Batch trigonometry through the SIMD kernels; see simd.h for their
+    // error bounds.  The inverse functions return radians, like Angle's.
+    static UNITIZED_INLINE void sin(const AngleArray& angles, double* out) noexcept;
+    static UNITIZED_INLINE void cos(const AngleArray& angles, double* out) noexcept;
+    static UNITIZED_INLINE void tan(const AngleArray& angles, double* out) noexcept;
+    static UNITIZED_INLINE void sin(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept;
+    static UNITIZED_INLINE void cos(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept;
+    static UNITIZED_INLINE void tan(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept;
+    static UNITIZED_INLINE void sincos(const AngleArray& angles, double* sin, double* cos) noexcept;
+    static UNITIZED_INLINE void sincos(const double* angles, double* sin, double* cos, std::size_t n,
+                                       Angle::Unit unit) noexcept;
+    // The same, in L2-sized chunks on policy's threads.
+    static UNITIZED_INLINE void sin(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy);
+    static UNITIZED_INLINE void cos(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy);
+    static UNITIZED_INLINE void tan(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy);
+    static UNITIZED_INLINE void sincos(const double* angles, double* sin, double* cos, std::size_t n,
+                                       Angle::Unit unit, const ExecutionPolicy& policy);
+    static UNITIZED_INLINE AngleArray asin(const double* values, std::size_t n);
+    static UNITIZED_INLINE AngleArray acos(const double* values, std::size_t n);
+    static UNITIZED_INLINE AngleArray atan(const double* values, std::size_t n);
+    static UNITIZED_INLINE AngleArray atan2(const double* y, const double* x, std::size_t n);
+
+private:
+    Angle::Unit columnUnit;
+    std::vector<double> values;
+
+    typedef void (*RadianKernel)(const double* in, double* out, std::size_t n);
+    static UNITIZED_INLINE void applyToRadians(RadianKernel kernel, const double* angles, double* out,
+                                               std::size_t n, Angle::Unit unit) noexcept;
+};
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "anglearray.inl"
+#endif
+
+#endif // UNITIZED_ANGLEARRAY_H
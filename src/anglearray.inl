@@ -0,0 +1,241 @@
+#include "simd.h"
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace unitized {
+
+UNITIZED_INLINE AngleArray::AngleArray(Angle::Unit unit): columnUnit(unit) {}
+UNITIZED_INLINE AngleArray::AngleArray(std::size_t size, Angle::Unit unit): columnUnit(unit), values(size) {}
+UNITIZED_INLINE AngleArray::AngleArray(std::vector<double> values, Angle::Unit unit):
+    columnUnit(unit), values(std::move(values)) {}
+
+UNITIZED_INLINE Angle::Unit AngleArray::unit() const noexcept {
+    return columnUnit;
+}
+UNITIZED_INLINE std::size_t AngleArray::size() const noexcept {
+    return values.size();
+}
+UNITIZED_INLINE bool AngleArray::empty() const noexcept {
+    return values.empty();
+}
+UNITIZED_INLINE const double* AngleArray::data() const noexcept {
+    return values.data();
+}
+UNITIZED_INLINE double* AngleArray::data() noexcept {
+    return values.data();
+}
+
+UNITIZED_INLINE Angle AngleArray::operator[](std::size_t index) const noexcept {
+    return Angle(values[index], columnUnit);
+}
+UNITIZED_INLINE void AngleArray::set(std::size_t index, Angle value) noexcept {
+    values[index] = value.convertTo(columnUnit);
+}
+UNITIZED_INLINE void AngleArray::push_back(Angle value) {
+    values.push_back(value.convertTo(columnUnit));
+}
+UNITIZED_INLINE void AngleArray::reserve(std::size_t capacity) {
+    values.reserve(capacity);
+}
+UNITIZED_INLINE void AngleArray::resize(std::size_t size) {
+    values.resize(size);
+}
+UNITIZED_INLINE void AngleArray::clear() noexcept {
+    values.clear();
+}
+
+UNITIZED_INLINE void AngleArray::convertTo(Angle::Unit unit, double* out) const noexcept {
+    Angle::Converter(columnUnit, unit).apply(values.data(), out, values.size());
+}
+UNITIZED_INLINE void AngleArray::convertTo(Angle::Unit unit, double* out, const ExecutionPolicy& policy) const {
+    Angle::Converter convert(columnUnit, unit);
+    policy.forEachChunk(values.size(), policy.chunkSize(2 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        convert.apply(values.data() + begin, out + begin, end - begin);
+    });
+}
+UNITIZED_INLINE std::vector<double> AngleArray::convertTo(Angle::Unit unit) const {
+    std::vector<double> result(values.size());
+    convertTo(unit, result.data());
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::as(Angle::Unit unit) const {
+    return AngleArray(convertTo(unit), unit);
+}
+
+UNITIZED_INLINE AngleArray AngleArray::add(const AngleArray& addend) const {
+    assert(addend.size() == size());
+    AngleArray result(values.size(), columnUnit);
+    Angle::Converter convert(addend.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] + convert(addend.values[i]);
+    }
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::sub(const AngleArray& subtrahend) const {
+    assert(subtrahend.size() == size());
+    AngleArray result(values.size(), columnUnit);
+    Angle::Converter convert(subtrahend.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] - convert(subtrahend.values[i]);
+    }
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::mul(double multiplicand) const {
+    AngleArray result(values.size(), columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] * multiplicand;
+    }
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::div(double denominator) const {
+    AngleArray result(values.size(), columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] / denominator;
+    }
+    return result;
+}
+
+UNITIZED_INLINE bool AngleArray::equals(const AngleArray& other) const noexcept {
+    if (other.size() != size()) return false;
+    Angle::Converter convert(other.columnUnit, columnUnit);
+    bool equal = true;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        equal &= values[i] == convert(other.values[i]);
+    }
+    return equal;
+}
+
+UNITIZED_INLINE std::vector<int> AngleArray::compareTo(const AngleArray& other) const {
+    assert(other.size() == size());
+    std::vector<int> result(values.size());
+    Angle::Converter convert(other.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        double otherValue = convert(other.values[i]);
+        result[i] = values[i] > otherValue ? 1 : values[i] < otherValue ? -1 : 0;
+    }
+    return result;
+}
+
+UNITIZED_INLINE void AngleArray::sin(const AngleArray& angles, double* out) noexcept {
+    sin(angles.data(), out, angles.size(), angles.unit());
+}
+UNITIZED_INLINE void AngleArray::cos(const AngleArray& angles, double* out) noexcept {
+    cos(angles.data(), out, angles.size(), angles.unit());
+}
+UNITIZED_INLINE void AngleArray::tan(const AngleArray& angles, double* out) noexcept {
+    tan(angles.data(), out, angles.size(), angles.unit());
+}
+UNITIZED_INLINE void AngleArray::sin(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept {
+    const simd::Kernels& kernels = simd::kernels();
+    double rightAngle = Angle::RightAngles[unit];
+    if (rightAngle) {
+        kernels.nativeSin(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.sin, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleArray::cos(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept {
+    const simd::Kernels& kernels = simd::kernels();
+    double rightAngle = Angle::RightAngles[unit];
+    if (rightAngle) {
+        kernels.nativeCos(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.cos, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleArray::tan(const double* angles, double* out, std::size_t n, Angle::Unit unit) noexcept {
+    const simd::Kernels& kernels = simd::kernels();
+    double rightAngle = Angle::RightAngles[unit];
+    if (rightAngle) {
+        kernels.nativeTan(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.tan, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleArray::sincos(const AngleArray& angles, double* sin, double* cos) noexcept {
+    sincos(angles.data(), sin, cos, angles.size(), angles.unit());
+}
+UNITIZED_INLINE void AngleArray::sincos(const double* angles, double* sin, double* cos, std::size_t n,
+                                       Angle::Unit unit) noexcept {
+    const simd::Kernels& kernels = simd::kernels();
+    double rightAngle = Angle::RightAngles[unit];
+    if (rightAngle) {
+        kernels.nativeSincos(angles, sin, cos, n, rightAngle);
+        return;
+    }
+    if (unit == Angle::Radians) {
+        kernels.sincos(angles, sin, cos, n);
+        return;
+    }
+    const std::size_t blockSize = 1024;
+    Angle::Converter toRadians(unit, Angle::Radians);
+    for (std::size_t i = 0; i < n; i += blockSize) {
+        std::size_t count = std::min(blockSize, n - i);
+        toRadians.apply(angles + i, sin + i, count);
+        kernels.sincos(sin + i, sin + i, cos + i, count);
+    }
+}
+UNITIZED_INLINE void AngleArray::sin(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(2 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        sin(angles + begin, out + begin, end - begin, unit);
+    });
+}
+UNITIZED_INLINE void AngleArray::cos(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(2 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        cos(angles + begin, out + begin, end - begin, unit);
+    });
+}
+UNITIZED_INLINE void AngleArray::tan(const double* angles, double* out, std::size_t n, Angle::Unit unit,
+                                    const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(2 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        tan(angles + begin, out + begin, end - begin, unit);
+    });
+}
+UNITIZED_INLINE void AngleArray::sincos(const double* angles, double* sin, double* cos, std::size_t n,
+                                       Angle::Unit unit, const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(3 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        sincos(angles + begin, sin + begin, cos + begin, end - begin, unit);
+    });
+}
+UNITIZED_INLINE AngleArray AngleArray::asin(const double* values, std::size_t n) {
+    AngleArray result(n, Angle::Radians);
+    simd::kernels().asin(values, result.data(), n);
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::acos(const double* values, std::size_t n) {
+    AngleArray result(n, Angle::Radians);
+    simd::kernels().acos(values, result.data(), n);
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::atan(const double* values, std::size_t n) {
+    AngleArray result(n, Angle::Radians);
+    simd::kernels().atan(values, result.data(), n);
+    return result;
+}
+UNITIZED_INLINE AngleArray AngleArray::atan2(const double* y, const double* x, std::size_t n) {
+    AngleArray result(n, Angle::Radians);
+    simd::kernels().atan2(y, x, result.data(), n);
+    return result;
+}
+
+// Converts to radians in out, a block at a time so it stays in cache, and
+// then runs the kernel in place.
+UNITIZED_INLINE void AngleArray::applyToRadians(RadianKernel kernel, const double* angles, double* out,
+                                               std::size_t n, Angle::Unit unit) noexcept {
+    if (unit == Angle::Radians) {
+        kernel(angles, out, n);
+        return;
+    }
+    const std::size_t blockSize = 1024;
+    Angle::Converter toRadians(unit, Angle::Radians);
+    for (std::size_t i = 0; i < n; i += blockSize) {
+        std::size_t count = std::min(blockSize, n - i);
+        toRadians.apply(angles + i, out + i, count);
+        kernel(out + i, out + i, count);
+    }
+}
+
+} // namespace unitized
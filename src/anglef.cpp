@@ -0,0 +1,5 @@
+#include "anglef.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "anglef.inl"
+#endif
@@ -0,0 +1,108 @@
+#ifndef UNITIZED_ANGLEF_H
+#define UNITIZED_ANGLEF_H
+
+#include "unitizedglobal.h"
+#include "angle.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace unitized {
+
+// An Angle with a float value, like LengthF.  Its batch trigonometry runs
+// on the float kernels; see simd::FloatKernels for their error bounds.
+class AngleF
+{
+public:
+    typedef Angle::Unit Unit;
+
+    // Converts float columns from one unit to another, or double columns to
+    // and from float with the conversion done in double.
+    class Converter
+    {
+    public:
+        UNITIZED_CONSTEXPR Converter(Unit from, Unit to) noexcept;
+
+        UNITIZED_INLINE float operator()(float value) const noexcept;
+        // out may be the same array as in.
+        UNITIZED_INLINE void apply(const float* in, float* out, std::size_t n) const noexcept;
+        // Returns false if any finite value overflowed to infinity or any
+        // nonzero value underflowed to zero; the rest are still converted.
+        UNITIZED_INLINE bool narrow(const double* in, float* out, std::size_t n) const noexcept;
+        UNITIZED_INLINE void widen(const float* in, double* out, std::size_t n) const noexcept;
+
+    private:
+        Angle::Converter converter;
+        bool linear;
+        double factor;
+    };
+
+    UNITIZED_CONSTEXPR AngleF(float value, Unit unit) noexcept;
+    // Rounds to the nearest float; see narrow() for a checked conversion.
+    UNITIZED_CONSTEXPR explicit AngleF(Angle angle) noexcept;
+    // Rounds angle into result, returning false if a finite value overflowed
+    // to infinity or a nonzero one underflowed to zero.
+    static UNITIZED_INLINE bool narrow(Angle angle, AngleF& result) noexcept;
+    UNITIZED_CONSTEXPR operator Angle() const noexcept;
+
+    static UNITIZED_CONSTEXPR AngleF degrees(float value) noexcept;
+    static UNITIZED_CONSTEXPR AngleF gradians(float value) noexcept;
+    static UNITIZED_CONSTEXPR AngleF radians(float value) noexcept;
+    static UNITIZED_CONSTEXPR AngleF milsNATO(float value) noexcept;
+    static UNITIZED_CONSTEXPR AngleF percentGrade(float value) noexcept;
+
+    // Computed in double like Angle's, and rounded.
+    static UNITIZED_INLINE float sin(AngleF angle) noexcept;
+    static UNITIZED_INLINE float cos(AngleF angle) noexcept;
+    static UNITIZED_INLINE float tan(AngleF angle) noexcept;
+    static UNITIZED_INLINE AngleF asin(float value) noexcept;
+    static UNITIZED_INLINE AngleF acos(float value) noexcept;
+    static UNITIZED_INLINE AngleF atan(float value) noexcept;
+    static UNITIZED_INLINE AngleF atan2(float y, float x) noexcept;
+
+    // Batch trigonometry of float columns through the float kernels.
+    static UNITIZED_INLINE void sin(const float* angles, float* out, std::size_t n, Unit unit) noexcept;
+    static UNITIZED_INLINE void cos(const float* angles, float* out, std::size_t n, Unit unit) noexcept;
+    static UNITIZED_INLINE void tan(const float* angles, float* out, std::size_t n, Unit unit) noexcept;
+    static UNITIZED_INLINE void sincos(const float* angles, float* sin, float* cos, std::size_t n,
+                                       Unit unit) noexcept;
+
+    UNITIZED_CONSTEXPR float convertTo(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR AngleF as(Unit unit) const noexcept;
+
+    UNITIZED_CONSTEXPR AngleF add(AngleF addend) const noexcept;
+    UNITIZED_CONSTEXPR AngleF sub(AngleF subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR AngleF mul(float multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR AngleF div(float denominator) const noexcept;
+    UNITIZED_CONSTEXPR float divUnitless(AngleF denominator) const noexcept;
+    UNITIZED_INLINE AngleF mod(AngleF modulus) const noexcept;
+    UNITIZED_INLINE AngleF abs() const noexcept;
+    UNITIZED_CONSTEXPR AngleF negate() const noexcept;
+    UNITIZED_INLINE bool isFinite() const noexcept;
+    UNITIZED_INLINE bool isInfinite() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isNegative() const noexcept;
+    UNITIZED_CONSTEXPR bool isPositive() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool isNonzero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(AngleF other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(AngleF other) const noexcept;
+
+    Unit unit;
+
+private:
+    float value;
+
+    typedef void (*RadianKernel)(const float* in, float* out, std::size_t n);
+    static UNITIZED_INLINE void applyToRadians(RadianKernel kernel, const float* angles, float* out,
+                                               std::size_t n, Unit unit) noexcept;
+};
+
+static_assert(std::is_trivially_copyable<AngleF>::value, "AngleF must be trivially copyable");
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "anglef.inl"
+#endif
+
+#endif // UNITIZED_ANGLEF_H
@@ -0,0 +1,224 @@
+#include "simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace unitized {
+
+// PercentGrade conversions aren't a factor, so they go one value at a time
+// through Angle::Converter in double.
+UNITIZED_CONSTEXPR AngleF::Converter::Converter(Unit from, Unit to) noexcept:
+    converter(from, to),
+    linear(from == to || (from != Angle::PercentGrade && to != Angle::PercentGrade)),
+    factor(Angle::conversionFactor(from, to)) {}
+
+UNITIZED_INLINE float AngleF::Converter::operator()(float value) const noexcept {
+    return static_cast<float>(converter(value));
+}
+UNITIZED_INLINE void AngleF::Converter::apply(const float* in, float* out, std::size_t n) const noexcept {
+    if (linear) {
+        simd::floatKernels().scale(in, out, n, factor);
+        return;
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = static_cast<float>(converter(in[i]));
+    }
+}
+UNITIZED_INLINE bool AngleF::Converter::narrow(const double* in, float* out, std::size_t n) const noexcept {
+    if (linear) return simd::floatKernels().narrow(in, out, n, factor) == 0;
+    bool exact = true;
+    for (std::size_t i = 0; i < n; i++) {
+        double value = converter(in[i]);
+        out[i] = static_cast<float>(value);
+        exact &= (std::isfinite(out[i]) || !std::isfinite(value)) && (out[i] != 0 || value == 0);
+    }
+    return exact;
+}
+UNITIZED_INLINE void AngleF::Converter::widen(const float* in, double* out, std::size_t n) const noexcept {
+    if (linear) {
+        simd::floatKernels().widen(in, out, n, factor);
+        return;
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = converter(in[i]);
+    }
+}
+
+UNITIZED_CONSTEXPR AngleF::AngleF(float value, Unit unit) noexcept: unit(unit), value(value) {}
+UNITIZED_CONSTEXPR AngleF::AngleF(Angle angle) noexcept:
+    unit(angle.unit), value(static_cast<float>(angle.value)) {}
+
+UNITIZED_INLINE bool AngleF::narrow(Angle angle, AngleF& result) noexcept {
+    result = AngleF(angle);
+    return (std::isfinite(result.value) || !std::isfinite(angle.value)) && (result.value != 0 || angle.value == 0);
+}
+
+UNITIZED_CONSTEXPR AngleF::operator Angle() const noexcept {
+    return Angle(value, unit);
+}
+
+UNITIZED_CONSTEXPR AngleF AngleF::degrees(float value) noexcept {
+    return AngleF(value, Angle::Degrees);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::gradians(float value) noexcept {
+    return AngleF(value, Angle::Gradians);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::radians(float value) noexcept {
+    return AngleF(value, Angle::Radians);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::milsNATO(float value) noexcept {
+    return AngleF(value, Angle::MilsNATO);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::percentGrade(float value) noexcept {
+    return AngleF(value, Angle::PercentGrade);
+}
+
+UNITIZED_INLINE float AngleF::sin(AngleF angle) noexcept {
+    return static_cast<float>(Angle::sin(angle));
+}
+UNITIZED_INLINE float AngleF::cos(AngleF angle) noexcept {
+    return static_cast<float>(Angle::cos(angle));
+}
+UNITIZED_INLINE float AngleF::tan(AngleF angle) noexcept {
+    return static_cast<float>(Angle::tan(angle));
+}
+UNITIZED_INLINE AngleF AngleF::asin(float value) noexcept {
+    return AngleF::radians(std::asin(value));
+}
+UNITIZED_INLINE AngleF AngleF::acos(float value) noexcept {
+    return AngleF::radians(std::acos(value));
+}
+UNITIZED_INLINE AngleF AngleF::atan(float value) noexcept {
+    return AngleF::radians(std::atan(value));
+}
+UNITIZED_INLINE AngleF AngleF::atan2(float y, float x) noexcept {
+    return AngleF::radians(std::atan2(y, x));
+}
+
+UNITIZED_INLINE void AngleF::sin(const float* angles, float* out, std::size_t n, Unit unit) noexcept {
+    const simd::FloatKernels& kernels = simd::floatKernels();
+    float rightAngle = static_cast<float>(Angle::RightAngles[unit]);
+    if (rightAngle) {
+        kernels.nativeSin(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.sin, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleF::cos(const float* angles, float* out, std::size_t n, Unit unit) noexcept {
+    const simd::FloatKernels& kernels = simd::floatKernels();
+    float rightAngle = static_cast<float>(Angle::RightAngles[unit]);
+    if (rightAngle) {
+        kernels.nativeCos(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.cos, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleF::tan(const float* angles, float* out, std::size_t n, Unit unit) noexcept {
+    const simd::FloatKernels& kernels = simd::floatKernels();
+    float rightAngle = static_cast<float>(Angle::RightAngles[unit]);
+    if (rightAngle) {
+        kernels.nativeTan(angles, out, n, rightAngle);
+    } else {
+        applyToRadians(kernels.tan, angles, out, n, unit);
+    }
+}
+UNITIZED_INLINE void AngleF::sincos(const float* angles, float* sin, float* cos, std::size_t n,
+                                    Unit unit) noexcept {
+    const simd::FloatKernels& kernels = simd::floatKernels();
+    float rightAngle = static_cast<float>(Angle::RightAngles[unit]);
+    if (rightAngle) {
+        kernels.nativeSincos(angles, sin, cos, n, rightAngle);
+        return;
+    }
+    if (unit == Angle::Radians) {
+        kernels.sincos(angles, sin, cos, n);
+        return;
+    }
+    const std::size_t blockSize = 1024;
+    Converter toRadians(unit, Angle::Radians);
+    for (std::size_t i = 0; i < n; i += blockSize) {
+        std::size_t count = std::min(blockSize, n - i);
+        toRadians.apply(angles + i, sin + i, count);
+        kernels.sincos(sin + i, sin + i, cos + i, count);
+    }
+}
+
+UNITIZED_CONSTEXPR float AngleF::convertTo(Unit unit) const noexcept {
+    return static_cast<float>(Angle::convert(value, AngleF::unit, unit));
+}
+UNITIZED_CONSTEXPR AngleF AngleF::as(Unit unit) const noexcept {
+    return AngleF(convertTo(unit), unit);
+}
+
+UNITIZED_CONSTEXPR AngleF AngleF::add(AngleF addend) const noexcept {
+    return AngleF(value + addend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::sub(AngleF subtrahend) const noexcept {
+    return AngleF(value - subtrahend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::mul(float multiplicand) const noexcept {
+    return AngleF(value * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::div(float denominator) const noexcept {
+    return AngleF(value / denominator, unit);
+}
+UNITIZED_CONSTEXPR float AngleF::divUnitless(AngleF denominator) const noexcept {
+    return value / denominator.convertTo(unit);
+}
+UNITIZED_INLINE AngleF AngleF::mod(AngleF modulus) const noexcept {
+    return AngleF(std::fmod(value, modulus.convertTo(unit)), unit);
+}
+
+UNITIZED_INLINE AngleF AngleF::abs() const noexcept {
+    return AngleF(std::fabs(value), unit);
+}
+UNITIZED_CONSTEXPR AngleF AngleF::negate() const noexcept {
+    return AngleF(-value, unit);
+}
+
+UNITIZED_INLINE bool AngleF::isFinite() const noexcept {
+    return std::isfinite(value);
+}
+UNITIZED_INLINE bool AngleF::isInfinite() const noexcept {
+    return std::isinf(value);
+}
+UNITIZED_INLINE bool AngleF::isNaN() const noexcept {
+    return std::isnan(value);
+}
+UNITIZED_CONSTEXPR bool AngleF::isNegative() const noexcept {
+    return value < 0;
+}
+UNITIZED_CONSTEXPR bool AngleF::isPositive() const noexcept {
+    return value > 0;
+}
+UNITIZED_CONSTEXPR bool AngleF::isZero() const noexcept {
+    return value == 0;
+}
+UNITIZED_CONSTEXPR bool AngleF::isNonzero() const noexcept {
+    return value != 0;
+}
+
+UNITIZED_CONSTEXPR bool AngleF::equals(AngleF other) const noexcept {
+    return value == other.convertTo(unit);
+}
+
+UNITIZED_CONSTEXPR int AngleF::compareTo(AngleF other) const noexcept {
+    float otherValue = other.convertTo(unit);
+    return value > otherValue ? 1 : value < otherValue ? -1 : 0;
+}
+
+UNITIZED_INLINE void AngleF::applyToRadians(RadianKernel kernel, const float* angles, float* out,
+                                            std::size_t n, Unit unit) noexcept {
+    if (unit == Angle::Radians) {
+        kernel(angles, out, n);
+        return;
+    }
+    const std::size_t blockSize = 1024;
+    Converter toRadians(unit, Angle::Radians);
+    for (std::size_t i = 0; i < n; i += blockSize) {
+        std::size_t count = std::min(blockSize, n - i);
+        toRadians.apply(angles + i, out + i, count);
+        kernel(out + i, out + i, count);
+    }
+}
+
+} // namespace unitized
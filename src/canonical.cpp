@@ -0,0 +1,5 @@
+#include "canonical.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "canonical.inl"
+#endif
@@ -0,0 +1,103 @@
+#ifndef UNITIZED_CANONICAL_H
+#define UNITIZED_CANONICAL_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include <type_traits>
+
+namespace unitized {
+
+// A Length stored in meters, whatever unit it was given in.  The unit it was
+// given in is kept only to display it in, so comparing and adding lengths of
+// different units is a single floating-point operation instead of a
+// conversion and an operation.  The price is that a value given in another
+// unit comes back out of it through two conversions, so it may differ from
+// the original in the last bit.
+class CanonicalLength
+{
+public:
+    UNITIZED_CONSTEXPR CanonicalLength(double value, Length::Unit unit) noexcept;
+    UNITIZED_CONSTEXPR CanonicalLength(Length length) noexcept;
+
+    static UNITIZED_CONSTEXPR CanonicalLength meters(double value) noexcept;
+
+    // The length in its display unit.
+    UNITIZED_CONSTEXPR Length length() const noexcept;
+    UNITIZED_CONSTEXPR double convertTo(Length::Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR double toMeters() const noexcept;
+    // The same length, displayed in unit.
+    UNITIZED_CONSTEXPR CanonicalLength as(Length::Unit unit) const noexcept;
+
+    UNITIZED_CONSTEXPR CanonicalLength add(CanonicalLength addend) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalLength sub(CanonicalLength subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalLength mul(double multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalLength div(double denominator) const noexcept;
+    UNITIZED_CONSTEXPR double divUnitless(CanonicalLength denominator) const noexcept;
+    UNITIZED_INLINE CanonicalLength abs() const noexcept;
+    UNITIZED_CONSTEXPR CanonicalLength negate() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(CanonicalLength other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(CanonicalLength other) const noexcept;
+
+    // The display unit.
+    Length::Unit unit;
+
+private:
+    double metersValue;
+
+    struct Meters {};
+    UNITIZED_CONSTEXPR CanonicalLength(Meters, double meters, Length::Unit unit) noexcept;
+};
+
+// An Angle stored in degrees, with its display unit as metadata, like
+// CanonicalLength.  Arithmetic is on the angles, so a PercentGrade display
+// unit adds grades as angles rather than as percentages.
+class CanonicalAngle
+{
+public:
+    UNITIZED_CONSTEXPR CanonicalAngle(double value, Angle::Unit unit) noexcept;
+    UNITIZED_CONSTEXPR CanonicalAngle(Angle angle) noexcept;
+
+    static UNITIZED_CONSTEXPR CanonicalAngle degrees(double value) noexcept;
+
+    // The angle in its display unit.
+    UNITIZED_CONSTEXPR Angle angle() const noexcept;
+    UNITIZED_CONSTEXPR double convertTo(Angle::Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR double toDegrees() const noexcept;
+    // The same angle, displayed in unit.
+    UNITIZED_CONSTEXPR CanonicalAngle as(Angle::Unit unit) const noexcept;
+
+    UNITIZED_CONSTEXPR CanonicalAngle add(CanonicalAngle addend) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalAngle sub(CanonicalAngle subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalAngle mul(double multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR CanonicalAngle div(double denominator) const noexcept;
+    UNITIZED_CONSTEXPR double divUnitless(CanonicalAngle denominator) const noexcept;
+    UNITIZED_INLINE CanonicalAngle abs() const noexcept;
+    UNITIZED_CONSTEXPR CanonicalAngle negate() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(CanonicalAngle other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(CanonicalAngle other) const noexcept;
+
+    // The display unit.
+    Angle::Unit unit;
+
+private:
+    double degreesValue;
+
+    struct Degrees {};
+    UNITIZED_CONSTEXPR CanonicalAngle(Degrees, double degrees, Angle::Unit unit) noexcept;
+};
+
+static_assert(std::is_trivially_copyable<CanonicalLength>::value, "CanonicalLength must be trivially copyable");
+static_assert(std::is_trivially_copyable<CanonicalAngle>::value, "CanonicalAngle must be trivially copyable");
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "canonical.inl"
+#endif
+
+#endif // UNITIZED_CANONICAL_H
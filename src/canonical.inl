@@ -0,0 +1,123 @@
+#include <cmath>
+
+namespace unitized {
+
+UNITIZED_CONSTEXPR CanonicalLength::CanonicalLength(double value, Length::Unit unit) noexcept:
+    unit(unit), metersValue(Length(value, unit).toMeters()) {}
+UNITIZED_CONSTEXPR CanonicalLength::CanonicalLength(Length length) noexcept:
+    unit(length.unit), metersValue(length.toMeters()) {}
+UNITIZED_CONSTEXPR CanonicalLength::CanonicalLength(Meters, double meters, Length::Unit unit) noexcept:
+    unit(unit), metersValue(meters) {}
+
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::meters(double value) noexcept {
+    return CanonicalLength(Meters(), value, Length::Meters);
+}
+
+UNITIZED_CONSTEXPR Length CanonicalLength::length() const noexcept {
+    return Length(convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR double CanonicalLength::convertTo(Length::Unit unit) const noexcept {
+    return Length::meters(metersValue).convertTo(unit);
+}
+UNITIZED_CONSTEXPR double CanonicalLength::toMeters() const noexcept {
+    return metersValue;
+}
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::as(Length::Unit unit) const noexcept {
+    return CanonicalLength(Meters(), metersValue, unit);
+}
+
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::add(CanonicalLength addend) const noexcept {
+    return CanonicalLength(Meters(), metersValue + addend.metersValue, unit);
+}
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::sub(CanonicalLength subtrahend) const noexcept {
+    return CanonicalLength(Meters(), metersValue - subtrahend.metersValue, unit);
+}
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::mul(double multiplicand) const noexcept {
+    return CanonicalLength(Meters(), metersValue * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::div(double denominator) const noexcept {
+    return CanonicalLength(Meters(), metersValue / denominator, unit);
+}
+UNITIZED_CONSTEXPR double CanonicalLength::divUnitless(CanonicalLength denominator) const noexcept {
+    return metersValue / denominator.metersValue;
+}
+UNITIZED_INLINE CanonicalLength CanonicalLength::abs() const noexcept {
+    return CanonicalLength(Meters(), std::fabs(metersValue), unit);
+}
+UNITIZED_CONSTEXPR CanonicalLength CanonicalLength::negate() const noexcept {
+    return CanonicalLength(Meters(), -metersValue, unit);
+}
+
+UNITIZED_INLINE bool CanonicalLength::isNaN() const noexcept {
+    return std::isnan(metersValue);
+}
+UNITIZED_CONSTEXPR bool CanonicalLength::isZero() const noexcept {
+    return metersValue == 0;
+}
+UNITIZED_CONSTEXPR bool CanonicalLength::equals(CanonicalLength other) const noexcept {
+    return metersValue == other.metersValue;
+}
+UNITIZED_CONSTEXPR int CanonicalLength::compareTo(CanonicalLength other) const noexcept {
+    return metersValue > other.metersValue ? 1 : metersValue < other.metersValue ? -1 : 0;
+}
+
+UNITIZED_CONSTEXPR CanonicalAngle::CanonicalAngle(double value, Angle::Unit unit) noexcept:
+    unit(unit), degreesValue(Angle(value, unit).toDegrees()) {}
+UNITIZED_CONSTEXPR CanonicalAngle::CanonicalAngle(Angle angle) noexcept:
+    unit(angle.unit), degreesValue(angle.toDegrees()) {}
+UNITIZED_CONSTEXPR CanonicalAngle::CanonicalAngle(Degrees, double degrees, Angle::Unit unit) noexcept:
+    unit(unit), degreesValue(degrees) {}
+
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::degrees(double value) noexcept {
+    return CanonicalAngle(Degrees(), value, Angle::Degrees);
+}
+
+UNITIZED_CONSTEXPR Angle CanonicalAngle::angle() const noexcept {
+    return Angle(convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR double CanonicalAngle::convertTo(Angle::Unit unit) const noexcept {
+    return Angle::degrees(degreesValue).convertTo(unit);
+}
+UNITIZED_CONSTEXPR double CanonicalAngle::toDegrees() const noexcept {
+    return degreesValue;
+}
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::as(Angle::Unit unit) const noexcept {
+    return CanonicalAngle(Degrees(), degreesValue, unit);
+}
+
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::add(CanonicalAngle addend) const noexcept {
+    return CanonicalAngle(Degrees(), degreesValue + addend.degreesValue, unit);
+}
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::sub(CanonicalAngle subtrahend) const noexcept {
+    return CanonicalAngle(Degrees(), degreesValue - subtrahend.degreesValue, unit);
+}
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::mul(double multiplicand) const noexcept {
+    return CanonicalAngle(Degrees(), degreesValue * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::div(double denominator) const noexcept {
+    return CanonicalAngle(Degrees(), degreesValue / denominator, unit);
+}
+UNITIZED_CONSTEXPR double CanonicalAngle::divUnitless(CanonicalAngle denominator) const noexcept {
+    return degreesValue / denominator.degreesValue;
+}
+UNITIZED_INLINE CanonicalAngle CanonicalAngle::abs() const noexcept {
+    return CanonicalAngle(Degrees(), std::fabs(degreesValue), unit);
+}
+UNITIZED_CONSTEXPR CanonicalAngle CanonicalAngle::negate() const noexcept {
+    return CanonicalAngle(Degrees(), -degreesValue, unit);
+}
+
+UNITIZED_INLINE bool CanonicalAngle::isNaN() const noexcept {
+    return std::isnan(degreesValue);
+}
+UNITIZED_CONSTEXPR bool CanonicalAngle::isZero() const noexcept {
+    return degreesValue == 0;
+}
+UNITIZED_CONSTEXPR bool CanonicalAngle::equals(CanonicalAngle other) const noexcept {
+    return degreesValue == other.degreesValue;
+}
+UNITIZED_CONSTEXPR int CanonicalAngle::compareTo(CanonicalAngle other) const noexcept {
+    return degreesValue > other.degreesValue ? 1 : degreesValue < other.degreesValue ? -1 : 0;
+}
+
+} // namespace unitized
@@ -0,0 +1,5 @@
+#include "compass.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "compass.inl"
+#endif
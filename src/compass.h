@@ -0,0 +1,115 @@
+#ifndef UNITIZED_COMPASS_H
+#define UNITIZED_COMPASS_H
+
+#include "unitizedglobal.h"
+#include "lengtharray.h"
+#include "anglearray.h"
+#include "threadpool.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace unitized {
+
+// The header of one survey in a Compass .DAT file.  Every string_view
+// points into the text that was read.
+struct CompassSurvey {
+    std::string_view cave;
+    std::string_view name;
+    std::string_view date;
+    std::string_view comment;
+    std::string_view team;
+    // Added to the azimuths to get true north; not applied by the reader.
+    Angle declination = Angle::degrees(0);
+    // How Compass displays the survey, such as DDDDUDLRLADN.  The file
+    // always stores feet and degrees, whatever it says.
+    std::string_view format;
+    // Instrument corrections, also not applied.
+    Angle azimuthCorrection = Angle::degrees(0);
+    Angle inclinationCorrection = Angle::degrees(0);
+    Length lengthCorrection = Length::feet(0);
+    Angle backAzimuthCorrection = Angle::degrees(0);
+    Angle backInclinationCorrection = Angle::degrees(0);
+    // Whether the shots have backsight columns.
+    bool hasBacksights = false;
+    // This survey's rows in CompassShots.
+    std::size_t firstShot = 0;
+    std::size_t shotCount = 0;
+};
+
+// The shots of every survey as columns, one row per shot, in file order.
+// Lengths are in feet and angles in degrees, as Compass stores them, and
+// missing values (Compass writes negative LRUDs and backsights of -999 for
+// them) are NaN.
+struct CompassShots {
+    // Shot flags, from the #|...# field.
+    enum Flag : std::uint8_t {
+        ExcludeFromLength = 1,    // L
+        ExcludeFromPlotting = 2,  // P
+        ExcludeFromAll = 4,       // X
+        NoClosure = 8             // C
+    };
+
+    UNITIZED_INLINE CompassShots();
+
+    UNITIZED_INLINE std::size_t size() const noexcept;
+    UNITIZED_INLINE void resize(std::size_t size);
+
+    // index of the shot's survey
+    std::vector<std::uint32_t> survey;
+    std::vector<std::string_view> from;
+    std::vector<std::string_view> to;
+    LengthArray length;
+    AngleArray azimuth;
+    AngleArray inclination;
+    AngleArray backAzimuth;
+    AngleArray backInclination;
+    LengthArray left;
+    LengthArray up;
+    LengthArray down;
+    LengthArray right;
+    // Flag bits
+    std::vector<std::uint8_t> flags;
+    std::vector<std::string_view> comment;
+};
+
+struct CompassDat {
+    std::vector<CompassSurvey> surveys;
+    CompassShots shots;
+};
+
+enum class CompassError {
+    None = 0,
+    // a survey without its DECLINATION line or the column headings
+    MissingHeader,
+    // a header or shot field that isn't a number
+    InvalidNumber,
+    // a shot line with too few fields
+    MissingField
+};
+
+// Like ParseResult: ptr is the end of the text, or where the error was found.
+struct CompassResult {
+    const char* ptr;
+    CompassError error;
+
+    explicit operator bool() const noexcept { return error == CompassError::None; }
+};
+
+// Reads the text of a Compass .DAT file, such as a MappedFile's, into out,
+// replacing what it held, without copying the text: station names and
+// comments point into it.  Surveys are separated by form feeds and don't
+// depend on each other, so a parallel policy parses them on the pool's
+// threads, straight into their rows of the columns.  On an error out is
+// left empty, and the error is the first one in the file.
+UNITIZED_INLINE CompassResult readCompassDat(std::string_view text, CompassDat& out,
+                                             const ExecutionPolicy& policy = ExecutionPolicy());
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "compass.inl"
+#endif
+
+#endif // UNITIZED_COMPASS_H
@@ -0,0 +1,287 @@
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+namespace unitized {
+
+namespace detail {
+
+// Compass writes -999 for backsights it doesn't have.
+inline constexpr double CompassMissingAngle = -900;
+
+// The line starting at p without its line ending, moving p to the next one.
+inline std::string_view nextCompassLine(const char*& p, const char* end) {
+    const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    std::string_view line(p, (newline ? newline : end) - p);
+    p = newline ? newline + 1 : end;
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    return line;
+}
+
+inline bool isCompassSpace(char c) {
+    // \x1a is the DOS end of file some files still end with
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\x1a';
+}
+inline std::string_view trimCompass(std::string_view text) {
+    while (!text.empty() && isCompassSpace(text.front())) text.remove_prefix(1);
+    while (!text.empty() && isCompassSpace(text.back())) text.remove_suffix(1);
+    return text;
+}
+// The next run of non-spaces in text, which moves past it.
+inline std::string_view nextCompassToken(std::string_view& text) {
+    std::size_t first = 0;
+    while (first < text.size() && isCompassSpace(text[first])) first++;
+    std::size_t last = first;
+    while (last < text.size() && !isCompassSpace(text[last])) last++;
+    std::string_view token = text.substr(first, last - first);
+    text.remove_prefix(last);
+    return token;
+}
+inline CompassError parseCompassNumber(std::string_view token, double& value) {
+    if (token.empty()) return CompassError::MissingField;
+    if (token.front() == '+' && token.size() > 1 && token[1] != '-') token.remove_prefix(1);
+    std::from_chars_result result = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (result.ec != std::errc() || result.ptr != token.data() + token.size()) return CompassError::InvalidNumber;
+    return CompassError::None;
+}
+// The text after key in line, or an empty view with a null data() if line
+// doesn't have it.
+inline std::string_view afterCompassKey(std::string_view line, std::string_view key) {
+    std::size_t at = line.find(key);
+    return at == std::string_view::npos ? std::string_view() : line.substr(at + key.size());
+}
+
+// Numbers that follow key in line, if it's there.
+inline CompassResult parseCompassValues(std::string_view line, std::string_view key, double* values, std::size_t n) {
+    std::string_view rest = afterCompassKey(line, key);
+    if (!rest.data()) return {line.data(), CompassError::None};
+    for (std::size_t i = 0; i < n; i++) {
+        std::string_view token = nextCompassToken(rest);
+        CompassError error = parseCompassNumber(token, values[i]);
+        if (error != CompassError::None) return {token.empty() ? rest.data() : token.data(), error};
+    }
+    return {rest.data(), CompassError::None};
+}
+
+inline bool isBlankCompassLine(std::string_view line) {
+    return trimCompass(line).empty();
+}
+
+// One survey's text, between form feeds.
+struct CompassBlock {
+    const char* first;
+    const char* last;
+    // where the shot lines start
+    const char* shots;
+    CompassResult result;
+};
+
+// Reads the header lines of a survey and counts its shots.
+inline CompassResult parseCompassHeader(CompassBlock& block, CompassSurvey& survey) {
+    const char* p = block.first;
+    // Form feeds are followed by a line ending, so the cave name is the first
+    // line that isn't blank.
+    std::string_view line;
+    do {
+        line = nextCompassLine(p, block.last);
+    } while (p != block.last && isBlankCompassLine(line));
+    if (afterCompassKey(line, "SURVEY NAME:").data()) {
+        // no cave name
+        p = line.data();
+    } else {
+        survey.cave = trimCompass(line);
+    }
+
+    bool declination = false;
+    for (;;) {
+        if (p == block.last) return {p, CompassError::MissingHeader};
+        line = nextCompassLine(p, block.last);
+        std::string_view trimmed = trimCompass(line);
+        if (trimmed.substr(0, 4) == "FROM") {
+            if (!declination) return {line.data(), CompassError::MissingHeader};
+            survey.hasBacksights = trimmed.find("AZM2") != std::string_view::npos;
+            break;
+        }
+
+        std::string_view value;
+        if ((value = afterCompassKey(trimmed, "SURVEY NAME:")).data()) {
+            survey.name = trimCompass(value);
+        } else if ((value = afterCompassKey(trimmed, "SURVEY DATE:")).data()) {
+            std::string_view comment = afterCompassKey(value, "COMMENT:");
+            survey.comment = trimCompass(comment);
+            survey.date = trimCompass(comment.data() ? value.substr(0, comment.data() - value.data() - 8) : value);
+        } else if (afterCompassKey(trimmed, "SURVEY TEAM:").data()) {
+            if (p != block.last) survey.team = trimCompass(nextCompassLine(p, block.last));
+        } else if (afterCompassKey(trimmed, "DECLINATION:").data()) {
+            declination = true;
+            double values[3] = {0, 0, 0};
+            CompassResult result = parseCompassValues(trimmed, "DECLINATION:", values, 1);
+            if (!result) return result;
+            survey.declination = Angle::degrees(values[0]);
+
+            std::string_view format = afterCompassKey(trimmed, "FORMAT:");
+            if (format.data()) survey.format = nextCompassToken(format);
+
+            values[0] = 0;
+            result = parseCompassValues(trimmed, "CORRECTIONS:", values, 3);
+            if (!result) return result;
+            survey.azimuthCorrection = Angle::degrees(values[0]);
+            survey.inclinationCorrection = Angle::degrees(values[1]);
+            survey.lengthCorrection = Length::feet(values[2]);
+
+            values[0] = values[1] = 0;
+            result = parseCompassValues(trimmed, "CORRECTIONS2:", values, 2);
+            if (!result) return result;
+            survey.backAzimuthCorrection = Angle::degrees(values[0]);
+            survey.backInclinationCorrection = Angle::degrees(values[1]);
+        }
+    }
+
+    block.shots = p;
+    std::size_t shots = 0;
+    while (p != block.last) {
+        shots += !isBlankCompassLine(nextCompassLine(p, block.last));
+    }
+    survey.shotCount = shots;
+    return {block.last, CompassError::None};
+}
+
+// Parses a survey's shot lines into rows [survey.firstShot,
+// survey.firstShot + survey.shotCount) of shots, whose columns must
+// already be that long.
+inline CompassResult parseCompassShots(const CompassBlock& block, const CompassSurvey& survey,
+                                       std::uint32_t surveyIndex, CompassShots& shots) {
+    double* columns[] = {
+        shots.length.data(), shots.azimuth.data(), shots.inclination.data(),
+        shots.left.data(), shots.up.data(), shots.down.data(), shots.right.data(),
+        shots.backAzimuth.data(), shots.backInclination.data()
+    };
+    std::size_t fields = survey.hasBacksights ? 9 : 7;
+
+    const char* p = block.shots;
+    std::size_t row = survey.firstShot;
+    while (p != block.last) {
+        std::string_view line = nextCompassLine(p, block.last);
+        if (isBlankCompassLine(line)) continue;
+
+        std::string_view rest = line;
+        shots.survey[row] = surveyIndex;
+        shots.from[row] = nextCompassToken(rest);
+        shots.to[row] = nextCompassToken(rest);
+        if (shots.to[row].empty()) return {rest.data(), CompassError::MissingField};
+        for (std::size_t i = 0; i < fields; i++) {
+            std::string_view token = nextCompassToken(rest);
+            double value;
+            CompassError error = parseCompassNumber(token, value);
+            if (error != CompassError::None) return {token.empty() ? rest.data() : token.data(), error};
+            // fields 3 to 6 are the LRUDs
+            if (i >= 3 && i <= 6 ? value < 0 : i > 0 && value < CompassMissingAngle) value = NAN;
+            columns[i][row] = value;
+        }
+        if (!survey.hasBacksights) {
+            columns[7][row] = NAN;
+            columns[8][row] = NAN;
+        }
+
+        std::uint8_t flags = 0;
+        rest = trimCompass(rest);
+        if (rest.substr(0, 2) == "#|") {
+            std::size_t close = rest.find('#', 2);
+            std::string_view letters = rest.substr(2, close == std::string_view::npos ? close : close - 2);
+            for (char c : letters) {
+                switch (c) {
+                case 'L': flags |= CompassShots::ExcludeFromLength; break;
+                case 'P': flags |= CompassShots::ExcludeFromPlotting; break;
+                case 'X': flags |= CompassShots::ExcludeFromAll; break;
+                case 'C': flags |= CompassShots::NoClosure; break;
+                default: break;
+                }
+            }
+            rest = close == std::string_view::npos ? std::string_view() : trimCompass(rest.substr(close + 1));
+        }
+        shots.flags[row] = flags;
+        shots.comment[row] = rest;
+        row++;
+    }
+    return {block.last, CompassError::None};
+}
+
+} // namespace detail
+
+UNITIZED_INLINE CompassShots::CompassShots():
+    length(Length::Feet), azimuth(Angle::Degrees), inclination(Angle::Degrees),
+    backAzimuth(Angle::Degrees), backInclination(Angle::Degrees),
+    left(Length::Feet), up(Length::Feet), down(Length::Feet), right(Length::Feet) {}
+
+UNITIZED_INLINE std::size_t CompassShots::size() const noexcept {
+    return survey.size();
+}
+
+UNITIZED_INLINE void CompassShots::resize(std::size_t size) {
+    survey.resize(size);
+    from.resize(size);
+    to.resize(size);
+    length.resize(size);
+    azimuth.resize(size);
+    inclination.resize(size);
+    backAzimuth.resize(size);
+    backInclination.resize(size);
+    left.resize(size);
+    up.resize(size);
+    down.resize(size);
+    right.resize(size);
+    flags.resize(size);
+    comment.resize(size);
+}
+
+UNITIZED_INLINE CompassResult readCompassDat(std::string_view text, CompassDat& out, const ExecutionPolicy& policy) {
+    out.surveys.clear();
+    out.shots.resize(0);
+
+    std::vector<detail::CompassBlock> blocks;
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p != end) {
+        const char* formFeed = static_cast<const char*>(std::memchr(p, '\f', end - p));
+        const char* last = formFeed ? formFeed : end;
+        if (!detail::trimCompass(std::string_view(p, last - p)).empty()) {
+            blocks.push_back(detail::CompassBlock{p, last, nullptr, {nullptr, CompassError::None}});
+        }
+        p = formFeed ? formFeed + 1 : end;
+    }
+
+    // Headers first, which count the shots, so each survey can then parse
+    // straight into its own rows.  Shots are parsed up to the first survey
+    // whose header failed, so the error returned is the first in the file.
+    std::vector<CompassSurvey> surveys(blocks.size());
+    policy.forEachChunk(blocks.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) blocks[i].result = detail::parseCompassHeader(blocks[i], surveys[i]);
+    });
+    std::size_t parsed = 0;
+    while (parsed < blocks.size() && blocks[parsed].result) parsed++;
+
+    std::size_t shots = 0;
+    for (std::size_t i = 0; i < parsed; i++) {
+        surveys[i].firstShot = shots;
+        shots += surveys[i].shotCount;
+    }
+    out.shots.resize(shots);
+    policy.forEachChunk(parsed, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            blocks[i].result = detail::parseCompassShots(blocks[i], surveys[i], static_cast<std::uint32_t>(i), out.shots);
+        }
+    });
+    for (const detail::CompassBlock& block : blocks) {
+        if (!block.result) {
+            out.shots.resize(0);
+            return block.result;
+        }
+    }
+
+    out.surveys = std::move(surveys);
+    return {end, CompassError::None};
+}
+
+} // namespace unitized
@@ -0,0 +1,5 @@
+#include "csv.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "csv.inl"
+#endif
@@ -0,0 +1,75 @@
+#ifndef UNITIZED_CSV_H
+#define UNITIZED_CSV_H
+
+#include "unitizedglobal.h"
+#include "lengtharray.h"
+#include "anglearray.h"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace unitized {
+
+enum class CsvError {
+    None = 0,
+    // a field that isn't a plain number
+    InvalidNumber,
+    // a row with fewer fields than the schema
+    MissingField,
+    // a row longer than the largest block findSeparators can index
+    RowTooLong
+};
+
+struct CsvResult {
+    // Rows appended to every column, or those before the error.
+    std::size_t rows;
+    CsvError error;
+    // Where the error is: the line in text, from 1, and the column, from 0.
+    std::size_t line;
+    std::size_t column;
+
+    explicit operator bool() const noexcept { return error == CsvError::None; }
+};
+
+// One column of a CSV file: skipped, or numbers in unit appended to a
+// LengthArray or AngleArray, converted to the array's unit.  Each array may
+// only appear once in a schema.
+struct CsvColumn {
+    static UNITIZED_INLINE CsvColumn skip() noexcept;
+    static UNITIZED_INLINE CsvColumn length(LengthArray& out, Length::Unit unit) noexcept;
+    static UNITIZED_INLINE CsvColumn angle(AngleArray& out, Angle::Unit unit) noexcept;
+
+    LengthArray* lengths;
+    AngleArray* angles;
+    int unit;
+};
+
+// Appends the columns of a CSV or TSV buffer, such as a memory-mapped file,
+// to the arrays in schema, skipping headerRows lines first.  Separators are
+// found a block at a time by the SIMD kernels and numbers are parsed with
+// std::from_chars straight into the arrays, so the only allocations are the
+// arrays' own growth.
+//
+// Fields are numbers without units or quotes, with spaces around them
+// ignored; an empty one is NaN.  Fields beyond the schema are ignored, blank
+// lines are skipped, and lines may end in \r\n.  On an error every array
+// keeps the rows before it.
+UNITIZED_INLINE CsvResult loadCsv(std::string_view text, const std::vector<CsvColumn>& schema,
+                                  char delimiter = ',', std::size_t headerRows = 0);
+
+namespace detail {
+
+// loadCsv, scanning blockSize bytes at a time and growing that up to
+// maxBlockSize for long rows.
+UNITIZED_INLINE CsvResult loadCsv(std::string_view text, const std::vector<CsvColumn>& schema, char delimiter,
+                                  std::size_t headerRows, std::size_t blockSize, std::size_t maxBlockSize);
+
+} // namespace detail
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "csv.inl"
+#endif
+
+#endif // UNITIZED_CSV_H
@@ -0,0 +1,149 @@
+#include "simd.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+namespace unitized {
+
+namespace detail {
+
+// Bytes of text given to findSeparators at a time.  A row that doesn't fit
+// doubles it, up to the most its 32-bit positions can index.
+inline constexpr std::size_t CsvBlockSize = 1 << 16;
+inline constexpr std::size_t CsvMaxBlockSize = std::size_t(1) << 31;
+
+inline bool isBlankCsvField(const char* first, const char* last) {
+    while (first != last && (*first == ' ' || *first == '\r')) first++;
+    return first == last;
+}
+
+inline bool parseCsvField(const char* first, const char* last, double& value) {
+    while (first != last && *first == ' ') first++;
+    while (last != first && (last[-1] == ' ' || last[-1] == '\r')) last--;
+    if (first == last) {
+        value = NAN;
+        return true;
+    }
+    // from_chars takes a minus sign but not a plus
+    if (*first == '+' && last - first > 1 && first[1] != '-') first++;
+    std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+} // namespace detail
+
+UNITIZED_INLINE CsvColumn CsvColumn::skip() noexcept {
+    return CsvColumn{nullptr, nullptr, 0};
+}
+UNITIZED_INLINE CsvColumn CsvColumn::length(LengthArray& out, Length::Unit unit) noexcept {
+    return CsvColumn{&out, nullptr, unit};
+}
+UNITIZED_INLINE CsvColumn CsvColumn::angle(AngleArray& out, Angle::Unit unit) noexcept {
+    return CsvColumn{nullptr, &out, unit};
+}
+
+UNITIZED_INLINE CsvResult loadCsv(std::string_view text, const std::vector<CsvColumn>& schema,
+                                  char delimiter, std::size_t headerRows) {
+    return detail::loadCsv(text, schema, delimiter, headerRows, detail::CsvBlockSize, detail::CsvMaxBlockSize);
+}
+
+UNITIZED_INLINE CsvResult detail::loadCsv(std::string_view text, const std::vector<CsvColumn>& schema, char delimiter,
+                                          std::size_t headerRows, std::size_t blockSize, std::size_t maxBlockSize) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    std::size_t line = 1;
+    if (text.substr(0, 3) == "\xef\xbb\xbf") p += 3;
+    for (; headerRows && p != end; headerRows--, line++) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        p = newline ? newline + 1 : end;
+    }
+
+    // Each column's rows from before this load, and where its next row goes.
+    std::vector<std::size_t> bases(schema.size());
+    std::vector<double*> targets(schema.size());
+    for (std::size_t i = 0; i < schema.size(); i++) {
+        bases[i] = schema[i].lengths ? schema[i].lengths->size() : schema[i].angles ? schema[i].angles->size() : 0;
+    }
+    auto resize = [&](std::size_t rows) {
+        for (std::size_t i = 0; i < schema.size(); i++) {
+            if (schema[i].lengths) {
+                schema[i].lengths->resize(bases[i] + rows);
+                targets[i] = schema[i].lengths->data() + bases[i];
+            } else if (schema[i].angles) {
+                schema[i].angles->resize(bases[i] + rows);
+                targets[i] = schema[i].angles->data() + bases[i];
+            }
+        }
+    };
+    auto done = [&](std::size_t rows, CsvError error, std::size_t column) {
+        resize(rows);
+        for (std::size_t i = 0; i < schema.size(); i++) {
+            if (schema[i].lengths && schema[i].unit != schema[i].lengths->unit()) {
+                Length::Converter(static_cast<Length::Unit>(schema[i].unit), schema[i].lengths->unit())
+                    .apply(targets[i], targets[i], rows);
+            } else if (schema[i].angles && schema[i].unit != schema[i].angles->unit()) {
+                Angle::Converter(static_cast<Angle::Unit>(schema[i].unit), schema[i].angles->unit())
+                    .apply(targets[i], targets[i], rows);
+            }
+        }
+        return CsvResult{rows, error, error == CsvError::None ? 0 : line, column};
+    };
+
+    const simd::Kernels& kernels = simd::kernels();
+    std::vector<std::uint32_t> positions;
+    std::size_t window = blockSize;
+    std::size_t rows = 0;
+    while (p != end) {
+        std::size_t length = std::min<std::size_t>(window, end - p);
+        positions.resize(length + 1);
+        std::size_t count = kernels.findSeparators(p, length, delimiter, positions.data());
+        // A last row without a newline ends at the end of the text, which
+        // stands in for one.  Otherwise the block is parsed up to its last
+        // newline and the rest is scanned again with the next block.
+        if (p + length == end && p[length - 1] != '\n') positions[count++] = static_cast<std::uint32_t>(length);
+        std::size_t rowsEnd = count;
+        while (rowsEnd && positions[rowsEnd - 1] != length && p[positions[rowsEnd - 1]] != '\n') rowsEnd--;
+        if (!rowsEnd) {
+            if (window >= maxBlockSize) return done(rows, CsvError::RowTooLong, 0);
+            window = std::min(window * 2, maxBlockSize);
+            continue;
+        }
+
+        std::size_t newlines = 0;
+        for (std::size_t k = 0; k < rowsEnd; k++) {
+            newlines += positions[k] == length || p[positions[k]] == '\n';
+        }
+        resize(rows + newlines);
+
+        std::size_t column = 0;
+        const char* field = p;
+        for (std::size_t k = 0; k < rowsEnd; k++) {
+            const char* separator = p + positions[k];
+            bool newline = positions[k] == length || *separator == '\n';
+            if (newline && column == 0 && isBlankCsvField(field, separator)) {
+                line++;
+                field = separator + 1;
+                continue;
+            }
+            if (column < schema.size() && targets[column] &&
+                    !parseCsvField(field, separator, targets[column][rows])) {
+                return done(rows, CsvError::InvalidNumber, column);
+            }
+            column++;
+            if (newline) {
+                if (column < schema.size()) return done(rows, CsvError::MissingField, column);
+                rows++;
+                line++;
+                column = 0;
+            }
+            field = separator + 1;
+        }
+        p = positions[rowsEnd - 1] == length ? end : p + positions[rowsEnd - 1] + 1;
+    }
+    return done(rows, CsvError::None, 0);
+}
+
+} // namespace unitized
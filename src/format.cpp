@@ -0,0 +1,5 @@
+#include "format.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "format.inl"
+#endif
@@ -0,0 +1,51 @@
+#ifndef UNITIZED_FORMAT_H
+#define UNITIZED_FORMAT_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include <charconv>
+#include <cstddef>
+
+namespace unitized {
+
+enum class FormatStyle {
+    // the fewest digits that parse back to the same double, then the unit:
+    // 12.5ft  0.1m  45deg  1.2rad  1600mil  12%
+    Shortest,
+    // precision digits after the point, then the unit: 12.50ft
+    Fixed,
+    // Lengths only, in feet and inches to precision digits: 5'3.25"
+    FeetInches,
+    // Angles only, in degrees, minutes and seconds to precision digits:
+    // 45°05'03.25"
+    DegreesMinutesSeconds
+};
+
+// Formats length into [buf, buf + n) like std::to_chars: independent of the
+// locale, without allocating, and without a terminating null.  On success
+// ptr is one past the last character written.  If the text doesn't fit, ec
+// is std::errc::value_too_large and ptr is buf + n; if the style is for
+// Angles or precision is negative, or above 9 in the FeetInches style, ec is
+// std::errc::invalid_argument and ptr is buf.  Finite values parse back with
+// parse(), to the same value in the Shortest style.  Signs apply to the
+// whole value, and values too large for a compound style, or not finite,
+// are written in the Shortest style.
+UNITIZED_INLINE std::to_chars_result format_to(char* buf, std::size_t n, Length length,
+                                               FormatStyle style = FormatStyle::Shortest,
+                                               int precision = 0) noexcept;
+
+// Formats an Angle the same way.  The DegreesMinutesSeconds style writes
+// the symbols for degrees (in UTF-8), minutes and seconds, and the others
+// write deg, grad, rad, mil or %.
+UNITIZED_INLINE std::to_chars_result format_to(char* buf, std::size_t n, Angle angle,
+                                               FormatStyle style = FormatStyle::Shortest,
+                                               int precision = 0) noexcept;
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "format.inl"
+#endif
+
+#endif // UNITIZED_FORMAT_H
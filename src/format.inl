@@ -0,0 +1,117 @@
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+
+namespace unitized {
+
+namespace detail {
+
+// Indexed by unit; parse() reads every one of them back.
+inline constexpr std::string_view LengthSuffixes[Length::Miles + 1] = {"", "m", "cm", "km", "ft", "yd", "in", "mi"};
+inline constexpr std::string_view AngleSuffixes[Angle::PercentGrade + 1] = {"", "deg", "grad", "rad", "mil", "%"};
+
+inline constexpr std::string_view DegreeSign = "\xc2\xb0";
+
+// The compound styles round to a whole number of 10^-precision of their
+// smallest part, which must stay exact in a double.
+inline constexpr int MaxCompoundPrecision = 9;
+inline constexpr double PowersOf10[MaxCompoundPrecision + 1] = {1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+// The append functions return one past what they wrote, or null once
+// something hasn't fit, which the ones after pass along.
+inline char* append(char* p, char* last, std::string_view text) {
+    if (!p || static_cast<std::size_t>(last - p) < text.size()) return nullptr;
+    std::memcpy(p, text.data(), text.size());
+    return p + text.size();
+}
+inline char* appendShortest(char* p, char* last, double value) {
+    if (!p) return nullptr;
+    std::to_chars_result result = std::to_chars(p, last, value);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+inline char* appendFixed(char* p, char* last, double value, int precision) {
+    if (!p) return nullptr;
+    std::to_chars_result result = std::to_chars(p, last, value, std::chars_format::fixed, precision);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+// A nonnegative value with at least two digits before the point.
+inline char* appendTwoDigits(char* p, char* last, double value, int precision) {
+    if (value < 10) p = append(p, last, "0");
+    return appendFixed(p, last, value, precision);
+}
+
+inline char* appendNumber(char* p, char* last, double value, FormatStyle style, int precision,
+                          std::string_view suffix) {
+    p = style == FormatStyle::Fixed ? appendFixed(p, last, value, precision) : appendShortest(p, last, value);
+    return append(p, last, suffix);
+}
+
+inline std::to_chars_result finish(char* buf, std::size_t n, char* p) {
+    if (!p) return {buf + n, std::errc::value_too_large};
+    return {p, std::errc()};
+}
+
+} // namespace detail
+
+UNITIZED_INLINE std::to_chars_result format_to(char* buf, std::size_t n, Length length,
+                                               FormatStyle style, int precision) noexcept {
+    char* last = buf + n;
+    if (precision < 0 || style == FormatStyle::DegreesMinutesSeconds ||
+            (style == FormatStyle::FeetInches && precision > detail::MaxCompoundPrecision)) {
+        return {buf, std::errc::invalid_argument};
+    }
+
+    if (style == FormatStyle::FeetInches) {
+        double inches = length.toInches();
+        double scale = detail::PowersOf10[precision];
+        double units = std::round(std::fabs(inches) * scale);
+        if (std::isfinite(units)) {
+            // rounding first carries 11.999" up into the feet
+            double rest = std::fmod(units, 12 * scale);
+            double feet = (units - rest) / (12 * scale);
+            char* p = std::signbit(inches) ? detail::append(buf, last, "-") : buf;
+            p = detail::appendFixed(p, last, feet, 0);
+            p = detail::append(p, last, "'");
+            p = detail::appendFixed(p, last, rest / scale, precision);
+            return detail::finish(buf, n, detail::append(p, last, "\""));
+        }
+        style = FormatStyle::Shortest;
+    }
+    char* p = detail::appendNumber(buf, last, length.convertTo(length.unit), style, precision,
+                                   detail::LengthSuffixes[length.unit]);
+    return detail::finish(buf, n, p);
+}
+
+UNITIZED_INLINE std::to_chars_result format_to(char* buf, std::size_t n, Angle angle,
+                                               FormatStyle style, int precision) noexcept {
+    char* last = buf + n;
+    if (precision < 0 || style == FormatStyle::FeetInches ||
+            (style == FormatStyle::DegreesMinutesSeconds && precision > detail::MaxCompoundPrecision)) {
+        return {buf, std::errc::invalid_argument};
+    }
+
+    if (style == FormatStyle::DegreesMinutesSeconds) {
+        double degrees = angle.toDegrees();
+        double scale = detail::PowersOf10[precision];
+        double units = std::round(std::fabs(degrees) * 3600 * scale);
+        if (std::isfinite(units)) {
+            double seconds = std::fmod(units, 60 * scale);
+            double totalMinutes = (units - seconds) / (60 * scale);
+            double minutes = std::fmod(totalMinutes, 60);
+            char* p = std::signbit(degrees) ? detail::append(buf, last, "-") : buf;
+            p = detail::appendFixed(p, last, (totalMinutes - minutes) / 60, 0);
+            p = detail::append(p, last, detail::DegreeSign);
+            p = detail::appendTwoDigits(p, last, minutes, 0);
+            p = detail::append(p, last, "'");
+            p = detail::appendTwoDigits(p, last, seconds / scale, precision);
+            return detail::finish(buf, n, detail::append(p, last, "\""));
+        }
+        style = FormatStyle::Shortest;
+    }
+    char* p = detail::appendNumber(buf, last, angle.convertTo(angle.unit), style, precision,
+                                   detail::AngleSuffixes[angle.unit]);
+    return detail::finish(buf, n, p);
+}
+
+} // namespace unitized
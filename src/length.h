@@ -1,7 +1,13 @@
 #ifndef UNITIZED_LENGTH_H
 #define UNITIZED_LENGTH_H
 
+#include "unitizedglobal.h"
 #include "angle.h"
+#include "unitnames.h"
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
 
 namespace unitized {
 
@@ -18,64 +24,127 @@ public:
         Miles = 7
     };
 
-    Length(double value, Unit unit);
-
-    static Length meters(double value);
-    static Length centimeters(double value);
-    static Length kilometers(double value);
-    static Length feet(double value);
-    static Length yards(double value);
-    static Length inches(double value);
-    static Length miles(double value);
-
-    static Angle atan2(Length y, Length x);
-
-    double convertTo(Unit unit) const;
-    double toMeters() const;
-    double toCentimeters() const;
-    double toKilometers() const;
-    double toFeet() const;
-    double toYards() const;
-    double toInches() const;
-    double toMiles() const;
-
-    Length as(Unit unit) const;
-    Length asMeters() const;
-    Length asCentimeters() const;
-    Length asKilometers() const;
-    Length asFeet() const;
-    Length asYards() const;
-    Length asInches() const;
-    Length asMiles() const;
-
-    Length add(Length addend) const;
-    Length sub(Length subtrahend) const;
-    Length mul(double multiplicand) const;
-    Length div(double denominator) const;
-    double divUnitless(Length denominator) const;
-    Length mod(Length modulus) const;
-    Length abs() const;
-    Length negate() const;
-    bool isFinite() const;
-    bool isInfinite() const;
-    bool isNaN() const;
-    bool isNegative() const;
-    bool isPositive() const;
-    bool isZero() const;
-    bool isNonzero() const;
-    bool equals(Length other) const;
-    int compareTo(Length other) const;
-
-    const Unit unit;
+    // Converts values from one unit to another with the factor looked up
+    // once, for converting whole columns of values.
+    class Converter
+    {
+    public:
+        UNITIZED_CONSTEXPR Converter(Unit from, Unit to) noexcept;
+
+        UNITIZED_CONSTEXPR double operator()(double value) const noexcept;
+        // out may be the same array as in.
+        UNITIZED_INLINE void apply(const double* in, double* out, std::size_t n) const noexcept;
+
+    private:
+        double factor;
+    };
+
+    UNITIZED_CONSTEXPR Length(double value, Unit unit) noexcept;
+
+    static UNITIZED_CONSTEXPR Length meters(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length centimeters(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length kilometers(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length feet(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length yards(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length inches(double value) noexcept;
+    static UNITIZED_CONSTEXPR Length miles(double value) noexcept;
+
+    static UNITIZED_INLINE Angle atan2(Length y, Length x) noexcept;
+
+    // The unit with the given symbol, abbreviation or name in any ASCII case
+    // ("ft", "FT", "feet", "metres", ...), or Unit(0) if there is none.
+    static UNITIZED_CONSTEXPR Unit parseUnit(std::string_view name) noexcept;
+
+    UNITIZED_CONSTEXPR double convertTo(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR double toMeters() const noexcept;
+    UNITIZED_CONSTEXPR double toCentimeters() const noexcept;
+    UNITIZED_CONSTEXPR double toKilometers() const noexcept;
+    UNITIZED_CONSTEXPR double toFeet() const noexcept;
+    UNITIZED_CONSTEXPR double toYards() const noexcept;
+    UNITIZED_CONSTEXPR double toInches() const noexcept;
+    UNITIZED_CONSTEXPR double toMiles() const noexcept;
+
+    UNITIZED_CONSTEXPR Length as(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR Length asMeters() const noexcept;
+    UNITIZED_CONSTEXPR Length asCentimeters() const noexcept;
+    UNITIZED_CONSTEXPR Length asKilometers() const noexcept;
+    UNITIZED_CONSTEXPR Length asFeet() const noexcept;
+    UNITIZED_CONSTEXPR Length asYards() const noexcept;
+    UNITIZED_CONSTEXPR Length asInches() const noexcept;
+    UNITIZED_CONSTEXPR Length asMiles() const noexcept;
+
+    UNITIZED_CONSTEXPR Length add(Length addend) const noexcept;
+    UNITIZED_CONSTEXPR Length sub(Length subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR Length mul(double multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR Length div(double denominator) const noexcept;
+    UNITIZED_CONSTEXPR double divUnitless(Length denominator) const noexcept;
+    UNITIZED_INLINE Length mod(Length modulus) const noexcept;
+    UNITIZED_INLINE Length abs() const noexcept;
+    UNITIZED_CONSTEXPR Length negate() const noexcept;
+    UNITIZED_INLINE bool isFinite() const noexcept;
+    UNITIZED_INLINE bool isInfinite() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isNegative() const noexcept;
+    UNITIZED_CONSTEXPR bool isPositive() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool isNonzero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(Length other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(Length other) const noexcept;
+
+    // Not const, so that Lengths can be assigned, swapped and sorted in place.
+    Unit unit;
 
 private:
-    const double value;
+    double value;
 
-    static double convert(double value, Unit from, Unit to);
-    static double fromBase(double value, Unit to);
-    static double toBase(double value, Unit from);
+    // Factors[from][to] converts a value from one unit to another with a
+    // single multiply.  Unit starts at 1, so row and column 0 are NaN, like
+    // every conversion of a unit that doesn't exist.
+    static constexpr double Factors[Miles + 1][Miles + 1] = {
+        {NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN},
+        // to: Meters, Centimeters, Kilometers, Feet, Yards, Inches, Miles
+        /* Meters */ {NAN, 1, 100, 0.001, 1 / 0.3048, 1 / 0.9144, 1 / 0.0254, 1 / 1609.344},
+        /* Centimeters */ {NAN, 0.01, 1, 0.00001, 1 / 30.48, 1 / 91.44, 1 / 2.54, 1 / 160934.4},
+        /* Kilometers */ {NAN, 1000, 100000, 1, 1 / 0.0003048, 1 / 0.0009144, 1 / 0.0000254, 1 / 1.609344},
+        /* Feet */ {NAN, 0.3048, 30.48, 0.0003048, 1, 1.0 / 3, 12, 1.0 / 5280},
+        /* Yards */ {NAN, 0.9144, 91.44, 0.0009144, 3, 1, 36, 1.0 / 1760},
+        /* Inches */ {NAN, 0.0254, 2.54, 0.0000254, 1.0 / 12, 1.0 / 36, 1, 1.0 / 63360},
+        /* Miles */ {NAN, 1609.344, 160934.4, 1.609344, 5280, 1760, 63360, 1}
+    };
+    // Factors[from][to], or NaN if either unit is out of range.
+    static constexpr double conversionFactor(Unit from, Unit to) noexcept {
+        return static_cast<unsigned>(from) <= Miles && static_cast<unsigned>(to) <= Miles ? Factors[from][to] : NAN;
+    }
+
+    // Everything parseUnit accepts, in lower case.
+    static constexpr detail::UnitName UnitNames[] = {
+        {"'", Feet}, {"\"", Inches},
+        {"m", Meters}, {"meter", Meters}, {"meters", Meters}, {"metre", Meters}, {"metres", Meters},
+        {"cm", Centimeters}, {"centimeter", Centimeters}, {"centimeters", Centimeters},
+        {"centimetre", Centimeters}, {"centimetres", Centimeters},
+        {"km", Kilometers}, {"kilometer", Kilometers}, {"kilometers", Kilometers},
+        {"kilometre", Kilometers}, {"kilometres", Kilometers},
+        {"ft", Feet}, {"foot", Feet}, {"feet", Feet},
+        {"yd", Yards}, {"yds", Yards}, {"yard", Yards}, {"yards", Yards},
+        {"in", Inches}, {"inch", Inches}, {"inches", Inches},
+        {"mi", Miles}, {"mile", Miles}, {"miles", Miles}
+    };
+    static constexpr detail::UnitNameTable<sizeof(UnitNames) / sizeof(UnitNames[0])> UnitNameLookup{UnitNames, 57709};
+    static_assert(UnitNameLookup.perfect, "UnitNames collide; search for a new seed");
+
+    static UNITIZED_CONSTEXPR double convert(double value, Unit from, Unit to) noexcept;
+
+    friend class LengthF;
+    friend struct LengthDimension;
 };
 
+// Lengths can be copied with memcpy and held in std::atomic.
+static_assert(std::is_trivially_copyable<Length>::value, "Length must be trivially copyable");
+
 } // namespace unitized
 
+#ifdef UNITIZED_HEADER_ONLY
+#include "length.inl"
+#endif
+
 #endif // UNITIZED_LENGTH_H
@@ -0,0 +1,158 @@
+#include "simd.h"
+#include <cmath>
+
+namespace unitized {
+
+UNITIZED_CONSTEXPR Length::Converter::Converter(Unit from, Unit to) noexcept: factor(conversionFactor(from, to)) {}
+
+UNITIZED_CONSTEXPR double Length::Converter::operator()(double value) const noexcept {
+    return value * factor;
+}
+UNITIZED_INLINE void Length::Converter::apply(const double* in, double* out, std::size_t n) const noexcept {
+    simd::kernels().scale(in, out, n, factor);
+}
+
+UNITIZED_CONSTEXPR Length::Length(double value, Unit unit) noexcept: unit(unit), value(value) {}
+
+UNITIZED_CONSTEXPR Length Length::meters(double value) noexcept {
+    return Length(value, Length::Meters);
+}
+UNITIZED_CONSTEXPR Length Length::centimeters(double value) noexcept {
+    return Length(value, Length::Centimeters);
+}
+UNITIZED_CONSTEXPR Length Length::kilometers(double value) noexcept {
+    return Length(value, Length::Kilometers);
+}
+UNITIZED_CONSTEXPR Length Length::feet(double value) noexcept {
+    return Length(value, Length::Feet);
+}
+UNITIZED_CONSTEXPR Length Length::yards(double value) noexcept {
+    return Length(value, Length::Yards);
+}
+UNITIZED_CONSTEXPR Length Length::inches(double value) noexcept {
+    return Length(value, Length::Inches);
+}
+UNITIZED_CONSTEXPR Length Length::miles(double value) noexcept {
+    return Length(value, Length::Miles);
+}
+
+UNITIZED_INLINE Angle Length::atan2(Length y, Length x) noexcept {
+    return Angle::atan2(y.convertTo(y.unit), x.convertTo(y.unit));
+}
+
+UNITIZED_CONSTEXPR Length::Unit Length::parseUnit(std::string_view name) noexcept {
+    return static_cast<Unit>(UnitNameLookup.find(name));
+}
+
+UNITIZED_CONSTEXPR double Length::convertTo(Unit unit) const noexcept {
+    return convert(value, Length::unit, unit);
+}
+UNITIZED_CONSTEXPR double Length::toMeters() const noexcept {
+    return convertTo(Length::Meters);
+}
+UNITIZED_CONSTEXPR double Length::toCentimeters() const noexcept {
+    return convertTo(Length::Centimeters);
+}
+UNITIZED_CONSTEXPR double Length::toKilometers() const noexcept {
+    return convertTo(Length::Kilometers);
+}
+UNITIZED_CONSTEXPR double Length::toFeet() const noexcept {
+    return convertTo(Length::Feet);
+}
+UNITIZED_CONSTEXPR double Length::toYards() const noexcept {
+    return convertTo(Length::Yards);
+}
+UNITIZED_CONSTEXPR double Length::toInches() const noexcept {
+    return convertTo(Length::Inches);
+}
+UNITIZED_CONSTEXPR double Length::toMiles() const noexcept {
+    return convertTo(Length::Miles);
+}
+
+UNITIZED_CONSTEXPR Length Length::as(Unit unit) const noexcept {
+    return Length(convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Length Length::asMeters() const noexcept {
+    return as(Length::Meters);
+}
+UNITIZED_CONSTEXPR Length Length::asCentimeters() const noexcept {
+    return as(Length::Centimeters);
+}
+UNITIZED_CONSTEXPR Length Length::asKilometers() const noexcept {
+    return as(Length::Kilometers);
+}
+UNITIZED_CONSTEXPR Length Length::asFeet() const noexcept {
+    return as(Length::Feet);
+}
+UNITIZED_CONSTEXPR Length Length::asYards() const noexcept {
+    return as(Length::Yards);
+}
+UNITIZED_CONSTEXPR Length Length::asInches() const noexcept {
+    return as(Length::Inches);
+}
+UNITIZED_CONSTEXPR Length Length::asMiles() const noexcept {
+    return as(Length::Miles);
+}
+
+UNITIZED_CONSTEXPR Length Length::add(Length addend) const noexcept {
+    return Length(value + addend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Length Length::sub(Length subtrahend) const noexcept {
+    return Length(value - subtrahend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR Length Length::mul(double multiplicand) const noexcept {
+    return Length(value * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR Length Length::div(double denominator) const noexcept {
+    return Length(value / denominator, unit);
+}
+UNITIZED_CONSTEXPR double Length::divUnitless(Length denominator) const noexcept {
+    return value / denominator.convertTo(unit);
+}
+UNITIZED_INLINE Length Length::mod(Length modulus) const noexcept {
+    return Length(std::fmod(value, modulus.convertTo(unit)), unit);
+}
+
+UNITIZED_INLINE Length Length::abs() const noexcept {
+    return Length(std::fabs(value), unit);
+}
+UNITIZED_CONSTEXPR Length Length::negate() const noexcept {
+    return Length(-value, unit);
+}
+
+UNITIZED_INLINE bool Length::isFinite() const noexcept {
+    return std::isfinite(value);
+}
+UNITIZED_INLINE bool Length::isInfinite() const noexcept {
+    return std::isinf(value);
+}
+UNITIZED_INLINE bool Length::isNaN() const noexcept {
+    return std::isnan(value);
+}
+UNITIZED_CONSTEXPR bool Length::isNegative() const noexcept {
+    return value < 0;
+}
+UNITIZED_CONSTEXPR bool Length::isPositive() const noexcept {
+    return value > 0;
+}
+UNITIZED_CONSTEXPR bool Length::isZero() const noexcept {
+    return value == 0;
+}
+UNITIZED_CONSTEXPR bool Length::isNonzero() const noexcept {
+    return value != 0;
+}
+
+UNITIZED_CONSTEXPR bool Length::equals(Length other) const noexcept {
+    return value == other.convertTo(unit);
+}
+
+UNITIZED_CONSTEXPR int Length::compareTo(Length other) const noexcept {
+    double otherValue = other.convertTo(unit);
+    return value > otherValue ? 1 : value < otherValue ? -1 : 0;
+}
+
+UNITIZED_CONSTEXPR double Length::convert(double value, Unit from, Unit to) noexcept {
+    return value * conversionFactor(from, to);
+}
+
+} // namespace unitized
@@ -0,0 +1,5 @@
+#include "lengtharray.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "lengtharray.inl"
+#endif
@@ -0,0 +1,58 @@
+#ifndef UNITIZED_LENGTHARRAY_H
+#define UNITIZED_LENGTHARRAY_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "threadpool.h"
+#include <cstddef>
+#include <vector>
+
+namespace unitized {
+
+// A column of lengths that all share one unit, stored as a contiguous array
+// of doubles.  Binary operations convert the other column into this column's
+// unit and require both columns to have the same size.
+class LengthArray
+{
+public:
+    UNITIZED_INLINE explicit LengthArray(Length::Unit unit);
+    UNITIZED_INLINE LengthArray(std::size_t size, Length::Unit unit);
+    UNITIZED_INLINE LengthArray(std::vector<double> values, Length::Unit unit);
+
+    UNITIZED_INLINE Length::Unit unit() const noexcept;
+    UNITIZED_INLINE std::size_t size() const noexcept;
+    UNITIZED_INLINE bool empty() const noexcept;
+    UNITIZED_INLINE const double* data() const noexcept;
+    UNITIZED_INLINE double* data() noexcept;
+
+    UNITIZED_INLINE Length operator[](std::size_t index) const noexcept;
+    UNITIZED_INLINE void set(std::size_t index, Length value) noexcept;
+    UNITIZED_INLINE void push_back(Length value);
+    UNITIZED_INLINE void reserve(std::size_t capacity);
+    UNITIZED_INLINE void resize(std::size_t size);
+    UNITIZED_INLINE void clear() noexcept;
+
+    UNITIZED_INLINE void convertTo(Length::Unit unit, double* out) const noexcept;
+    UNITIZED_INLINE void convertTo(Length::Unit unit, double* out, const ExecutionPolicy& policy) const;
+    UNITIZED_INLINE std::vector<double> convertTo(Length::Unit unit) const;
+    UNITIZED_INLINE LengthArray as(Length::Unit unit) const;
+
+    UNITIZED_INLINE LengthArray add(const LengthArray& addend) const;
+    UNITIZED_INLINE LengthArray sub(const LengthArray& subtrahend) const;
+    UNITIZED_INLINE LengthArray mul(double multiplicand) const;
+    UNITIZED_INLINE LengthArray div(double denominator) const;
+    UNITIZED_INLINE bool equals(const LengthArray& other) const noexcept;
+    UNITIZED_INLINE std::vector<int> compareTo(const LengthArray& other) const;
+
+private:
+    Length::Unit columnUnit;
+    std::vector<double> values;
+};
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "lengtharray.inl"
+#endif
+
+#endif // UNITIZED_LENGTHARRAY_H
@@ -0,0 +1,118 @@
+#include <cassert>
+#include <utility>
+
+namespace unitized {
+
+UNITIZED_INLINE LengthArray::LengthArray(Length::Unit unit): columnUnit(unit) {}
+UNITIZED_INLINE LengthArray::LengthArray(std::size_t size, Length::Unit unit): columnUnit(unit), values(size) {}
+UNITIZED_INLINE LengthArray::LengthArray(std::vector<double> values, Length::Unit unit):
+    columnUnit(unit), values(std::move(values)) {}
+
+UNITIZED_INLINE Length::Unit LengthArray::unit() const noexcept {
+    return columnUnit;
+}
+UNITIZED_INLINE std::size_t LengthArray::size() const noexcept {
+    return values.size();
+}
+UNITIZED_INLINE bool LengthArray::empty() const noexcept {
+    return values.empty();
+}
+UNITIZED_INLINE const double* LengthArray::data() const noexcept {
+    return values.data();
+}
+UNITIZED_INLINE double* LengthArray::data() noexcept {
+    return values.data();
+}
+
+UNITIZED_INLINE Length LengthArray::operator[](std::size_t index) const noexcept {
+    return Length(values[index], columnUnit);
+}
+UNITIZED_INLINE void LengthArray::set(std::size_t index, Length value) noexcept {
+    values[index] = value.convertTo(columnUnit);
+}
+UNITIZED_INLINE void LengthArray::push_back(Length value) {
+    values.push_back(value.convertTo(columnUnit));
+}
+UNITIZED_INLINE void LengthArray::reserve(std::size_t capacity) {
+    values.reserve(capacity);
+}
+UNITIZED_INLINE void LengthArray::resize(std::size_t size) {
+    values.resize(size);
+}
+UNITIZED_INLINE void LengthArray::clear() noexcept {
+    values.clear();
+}
+
+UNITIZED_INLINE void LengthArray::convertTo(Length::Unit unit, double* out) const noexcept {
+    Length::Converter(columnUnit, unit).apply(values.data(), out, values.size());
+}
+UNITIZED_INLINE void LengthArray::convertTo(Length::Unit unit, double* out, const ExecutionPolicy& policy) const {
+    Length::Converter convert(columnUnit, unit);
+    policy.forEachChunk(values.size(), policy.chunkSize(2 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        convert.apply(values.data() + begin, out + begin, end - begin);
+    });
+}
+UNITIZED_INLINE std::vector<double> LengthArray::convertTo(Length::Unit unit) const {
+    std::vector<double> result(values.size());
+    convertTo(unit, result.data());
+    return result;
+}
+UNITIZED_INLINE LengthArray LengthArray::as(Length::Unit unit) const {
+    return LengthArray(convertTo(unit), unit);
+}
+
+UNITIZED_INLINE LengthArray LengthArray::add(const LengthArray& addend) const {
+    assert(addend.size() == size());
+    LengthArray result(values.size(), columnUnit);
+    Length::Converter convert(addend.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] + convert(addend.values[i]);
+    }
+    return result;
+}
+UNITIZED_INLINE LengthArray LengthArray::sub(const LengthArray& subtrahend) const {
+    assert(subtrahend.size() == size());
+    LengthArray result(values.size(), columnUnit);
+    Length::Converter convert(subtrahend.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] - convert(subtrahend.values[i]);
+    }
+    return result;
+}
+UNITIZED_INLINE LengthArray LengthArray::mul(double multiplicand) const {
+    LengthArray result(values.size(), columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] * multiplicand;
+    }
+    return result;
+}
+UNITIZED_INLINE LengthArray LengthArray::div(double denominator) const {
+    LengthArray result(values.size(), columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        result.values[i] = values[i] / denominator;
+    }
+    return result;
+}
+
+UNITIZED_INLINE bool LengthArray::equals(const LengthArray& other) const noexcept {
+    if (other.size() != size()) return false;
+    Length::Converter convert(other.columnUnit, columnUnit);
+    bool equal = true;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        equal &= values[i] == convert(other.values[i]);
+    }
+    return equal;
+}
+
+UNITIZED_INLINE std::vector<int> LengthArray::compareTo(const LengthArray& other) const {
+    assert(other.size() == size());
+    std::vector<int> result(values.size());
+    Length::Converter convert(other.columnUnit, columnUnit);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        double otherValue = convert(other.values[i]);
+        result[i] = values[i] > otherValue ? 1 : values[i] < otherValue ? -1 : 0;
+    }
+    return result;
+}
+
+} // namespace unitized
@@ -0,0 +1,5 @@
+#include "lengthf.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "lengthf.inl"
+#endif
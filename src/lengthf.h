@@ -0,0 +1,90 @@
+#ifndef UNITIZED_LENGTHF_H
+#define UNITIZED_LENGTHF_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace unitized {
+
+// A Length with a float value, for rendering, spatial indexes and previews
+// that don't need double precision.  It takes half the memory of a Length,
+// and its columns go through the float kernels with twice the SIMD lanes.
+// Narrowing from Length is explicit; widening back is implicit and exact.
+class LengthF
+{
+public:
+    typedef Length::Unit Unit;
+
+    // Converts float columns from one unit to another, or double columns to
+    // and from float with the conversion done in double.
+    class Converter
+    {
+    public:
+        UNITIZED_CONSTEXPR Converter(Unit from, Unit to) noexcept;
+
+        UNITIZED_CONSTEXPR float operator()(float value) const noexcept;
+        // out may be the same array as in.
+        UNITIZED_INLINE void apply(const float* in, float* out, std::size_t n) const noexcept;
+        // Returns false if any finite value overflowed to infinity or any
+        // nonzero value underflowed to zero; the rest are still converted.
+        UNITIZED_INLINE bool narrow(const double* in, float* out, std::size_t n) const noexcept;
+        UNITIZED_INLINE void widen(const float* in, double* out, std::size_t n) const noexcept;
+
+    private:
+        double factor;
+    };
+
+    UNITIZED_CONSTEXPR LengthF(float value, Unit unit) noexcept;
+    // Rounds to the nearest float; see narrow() for a checked conversion.
+    UNITIZED_CONSTEXPR explicit LengthF(Length length) noexcept;
+    // Rounds length into result, returning false if a finite value overflowed
+    // to infinity or a nonzero one underflowed to zero.
+    static UNITIZED_INLINE bool narrow(Length length, LengthF& result) noexcept;
+    UNITIZED_CONSTEXPR operator Length() const noexcept;
+
+    static UNITIZED_CONSTEXPR LengthF meters(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF centimeters(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF kilometers(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF feet(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF yards(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF inches(float value) noexcept;
+    static UNITIZED_CONSTEXPR LengthF miles(float value) noexcept;
+
+    UNITIZED_CONSTEXPR float convertTo(Unit unit) const noexcept;
+    UNITIZED_CONSTEXPR LengthF as(Unit unit) const noexcept;
+
+    UNITIZED_CONSTEXPR LengthF add(LengthF addend) const noexcept;
+    UNITIZED_CONSTEXPR LengthF sub(LengthF subtrahend) const noexcept;
+    UNITIZED_CONSTEXPR LengthF mul(float multiplicand) const noexcept;
+    UNITIZED_CONSTEXPR LengthF div(float denominator) const noexcept;
+    UNITIZED_CONSTEXPR float divUnitless(LengthF denominator) const noexcept;
+    UNITIZED_INLINE LengthF mod(LengthF modulus) const noexcept;
+    UNITIZED_INLINE LengthF abs() const noexcept;
+    UNITIZED_CONSTEXPR LengthF negate() const noexcept;
+    UNITIZED_INLINE bool isFinite() const noexcept;
+    UNITIZED_INLINE bool isInfinite() const noexcept;
+    UNITIZED_INLINE bool isNaN() const noexcept;
+    UNITIZED_CONSTEXPR bool isNegative() const noexcept;
+    UNITIZED_CONSTEXPR bool isPositive() const noexcept;
+    UNITIZED_CONSTEXPR bool isZero() const noexcept;
+    UNITIZED_CONSTEXPR bool isNonzero() const noexcept;
+    UNITIZED_CONSTEXPR bool equals(LengthF other) const noexcept;
+    UNITIZED_CONSTEXPR int compareTo(LengthF other) const noexcept;
+
+    Unit unit;
+
+private:
+    float value;
+};
+
+static_assert(std::is_trivially_copyable<LengthF>::value, "LengthF must be trivially copyable");
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "lengthf.inl"
+#endif
+
+#endif // UNITIZED_LENGTHF_H
@@ -0,0 +1,120 @@
+#include "simd.h"
+#include <cmath>
+
+namespace unitized {
+
+UNITIZED_CONSTEXPR LengthF::Converter::Converter(Unit from, Unit to) noexcept: factor(Length::conversionFactor(from, to)) {}
+
+UNITIZED_CONSTEXPR float LengthF::Converter::operator()(float value) const noexcept {
+    return static_cast<float>(value * factor);
+}
+UNITIZED_INLINE void LengthF::Converter::apply(const float* in, float* out, std::size_t n) const noexcept {
+    simd::floatKernels().scale(in, out, n, factor);
+}
+UNITIZED_INLINE bool LengthF::Converter::narrow(const double* in, float* out, std::size_t n) const noexcept {
+    return simd::floatKernels().narrow(in, out, n, factor) == 0;
+}
+UNITIZED_INLINE void LengthF::Converter::widen(const float* in, double* out, std::size_t n) const noexcept {
+    simd::floatKernels().widen(in, out, n, factor);
+}
+
+UNITIZED_CONSTEXPR LengthF::LengthF(float value, Unit unit) noexcept: unit(unit), value(value) {}
+UNITIZED_CONSTEXPR LengthF::LengthF(Length length) noexcept:
+    unit(length.unit), value(static_cast<float>(length.value)) {}
+
+UNITIZED_INLINE bool LengthF::narrow(Length length, LengthF& result) noexcept {
+    result = LengthF(length);
+    return (std::isfinite(result.value) || !std::isfinite(length.value)) && (result.value != 0 || length.value == 0);
+}
+
+UNITIZED_CONSTEXPR LengthF::operator Length() const noexcept {
+    return Length(value, unit);
+}
+
+UNITIZED_CONSTEXPR LengthF LengthF::meters(float value) noexcept {
+    return LengthF(value, Length::Meters);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::centimeters(float value) noexcept {
+    return LengthF(value, Length::Centimeters);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::kilometers(float value) noexcept {
+    return LengthF(value, Length::Kilometers);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::feet(float value) noexcept {
+    return LengthF(value, Length::Feet);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::yards(float value) noexcept {
+    return LengthF(value, Length::Yards);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::inches(float value) noexcept {
+    return LengthF(value, Length::Inches);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::miles(float value) noexcept {
+    return LengthF(value, Length::Miles);
+}
+
+UNITIZED_CONSTEXPR float LengthF::convertTo(Unit unit) const noexcept {
+    return Converter(LengthF::unit, unit)(value);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::as(Unit unit) const noexcept {
+    return LengthF(convertTo(unit), unit);
+}
+
+UNITIZED_CONSTEXPR LengthF LengthF::add(LengthF addend) const noexcept {
+    return LengthF(value + addend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::sub(LengthF subtrahend) const noexcept {
+    return LengthF(value - subtrahend.convertTo(unit), unit);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::mul(float multiplicand) const noexcept {
+    return LengthF(value * multiplicand, unit);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::div(float denominator) const noexcept {
+    return LengthF(value / denominator, unit);
+}
+UNITIZED_CONSTEXPR float LengthF::divUnitless(LengthF denominator) const noexcept {
+    return value / denominator.convertTo(unit);
+}
+UNITIZED_INLINE LengthF LengthF::mod(LengthF modulus) const noexcept {
+    return LengthF(std::fmod(value, modulus.convertTo(unit)), unit);
+}
+
+UNITIZED_INLINE LengthF LengthF::abs() const noexcept {
+    return LengthF(std::fabs(value), unit);
+}
+UNITIZED_CONSTEXPR LengthF LengthF::negate() const noexcept {
+    return LengthF(-value, unit);
+}
+
+UNITIZED_INLINE bool LengthF::isFinite() const noexcept {
+    return std::isfinite(value);
+}
+UNITIZED_INLINE bool LengthF::isInfinite() const noexcept {
+    return std::isinf(value);
+}
+UNITIZED_INLINE bool LengthF::isNaN() const noexcept {
+    return std::isnan(value);
+}
+UNITIZED_CONSTEXPR bool LengthF::isNegative() const noexcept {
+    return value < 0;
+}
+UNITIZED_CONSTEXPR bool LengthF::isPositive() const noexcept {
+    return value > 0;
+}
+UNITIZED_CONSTEXPR bool LengthF::isZero() const noexcept {
+    return value == 0;
+}
+UNITIZED_CONSTEXPR bool LengthF::isNonzero() const noexcept {
+    return value != 0;
+}
+
+UNITIZED_CONSTEXPR bool LengthF::equals(LengthF other) const noexcept {
+    return value == other.convertTo(unit);
+}
+
+UNITIZED_CONSTEXPR int LengthF::compareTo(LengthF other) const noexcept {
+    float otherValue = other.convertTo(unit);
+    return value > otherValue ? 1 : value < otherValue ? -1 : 0;
+}
+
+} // namespace unitized
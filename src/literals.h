@@ -0,0 +1,47 @@
+#ifndef UNITIZED_LITERALS_H
+#define UNITIZED_LITERALS_H
+
+#include "unitizedglobal.h"
+#include "quantity.h"
+
+namespace unitized {
+inline namespace literals {
+
+// Literals for every Length and Angle unit, as in 10_ft + 3_in.  They make
+// compile-time Quantities, so arithmetic on them folds to a constant in any
+// build, and they convert implicitly to Length and Angle.  Grades aren't a
+// linear unit, so _pct makes a runtime Angle, constexpr in header-only builds.
+
+#define UNITIZED_LITERAL(suffix, Type) \
+    constexpr Type operator"" suffix(long double value) noexcept { \
+        return Type(static_cast<double>(value)); \
+    } \
+    constexpr Type operator"" suffix(unsigned long long value) noexcept { \
+        return Type(static_cast<double>(value)); \
+    }
+
+UNITIZED_LITERAL(_m, LengthIn<Length::Meters>)
+UNITIZED_LITERAL(_cm, LengthIn<Length::Centimeters>)
+UNITIZED_LITERAL(_km, LengthIn<Length::Kilometers>)
+UNITIZED_LITERAL(_ft, LengthIn<Length::Feet>)
+UNITIZED_LITERAL(_yd, LengthIn<Length::Yards>)
+UNITIZED_LITERAL(_in, LengthIn<Length::Inches>)
+UNITIZED_LITERAL(_mi, LengthIn<Length::Miles>)
+UNITIZED_LITERAL(_deg, AngleIn<Angle::Degrees>)
+UNITIZED_LITERAL(_grad, AngleIn<Angle::Gradians>)
+UNITIZED_LITERAL(_rad, AngleIn<Angle::Radians>)
+UNITIZED_LITERAL(_mil, AngleIn<Angle::MilsNATO>)
+
+#undef UNITIZED_LITERAL
+
+inline UNITIZED_CONSTEXPR Angle operator"" _pct(long double value) noexcept {
+    return Angle::percentGrade(static_cast<double>(value));
+}
+inline UNITIZED_CONSTEXPR Angle operator"" _pct(unsigned long long value) noexcept {
+    return Angle::percentGrade(static_cast<double>(value));
+}
+
+} // namespace literals
+} // namespace unitized
+
+#endif // UNITIZED_LITERALS_H
@@ -0,0 +1,5 @@
+#include "mappedfile.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "mappedfile.inl"
+#endif
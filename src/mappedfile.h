@@ -0,0 +1,46 @@
+#ifndef UNITIZED_MAPPEDFILE_H
+#define UNITIZED_MAPPEDFILE_H
+
+#include "unitizedglobal.h"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace unitized {
+
+// A whole file as read-only text, memory-mapped on POSIX systems so readers
+// can parse it in place, and read into memory elsewhere.  Views into text()
+// last until the file is closed.
+class MappedFile
+{
+public:
+    UNITIZED_INLINE MappedFile() noexcept;
+    UNITIZED_INLINE MappedFile(MappedFile&& other) noexcept;
+    UNITIZED_INLINE MappedFile& operator=(MappedFile&& other) noexcept;
+    UNITIZED_INLINE ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Opens path, closing any file open before.  Returns false, with errno
+    // set, if it can't be read.
+    UNITIZED_INLINE bool open(const char* path);
+    UNITIZED_INLINE void close() noexcept;
+
+    UNITIZED_INLINE bool isOpen() const noexcept;
+    UNITIZED_INLINE std::string_view text() const noexcept;
+
+private:
+    const char* data;
+    std::size_t size;
+    bool mapped;
+    bool opened;
+    std::vector<char> buffer;
+};
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "mappedfile.inl"
+#endif
+
+#endif // UNITIZED_MAPPEDFILE_H
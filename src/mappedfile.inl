@@ -0,0 +1,103 @@
+#include <cstdio>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace unitized {
+
+UNITIZED_INLINE MappedFile::MappedFile() noexcept: data(nullptr), size(0), mapped(false), opened(false) {}
+
+UNITIZED_INLINE MappedFile::MappedFile(MappedFile&& other) noexcept:
+    data(other.data), size(other.size), mapped(other.mapped), opened(other.opened),
+    buffer(std::move(other.buffer)) {
+    other.data = nullptr;
+    other.size = 0;
+    other.mapped = false;
+    other.opened = false;
+}
+
+UNITIZED_INLINE MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(mapped, other.mapped);
+        std::swap(opened, other.opened);
+        buffer.swap(other.buffer);
+    }
+    return *this;
+}
+
+UNITIZED_INLINE MappedFile::~MappedFile() {
+    close();
+}
+
+UNITIZED_INLINE bool MappedFile::open(const char* path) {
+    close();
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        ::close(fd);
+        return false;
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    // mmap rejects empty files, which are just empty text
+    if (size) {
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            size = 0;
+            return false;
+        }
+        madvise(address, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(address);
+        mapped = true;
+    }
+    ::close(fd);
+#else
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) return false;
+    char chunk[1 << 16];
+    std::size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) buffer.insert(buffer.end(), chunk, chunk + read);
+    bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+    if (failed) {
+        buffer.clear();
+        return false;
+    }
+    data = buffer.data();
+    size = buffer.size();
+#endif
+    opened = true;
+    return true;
+}
+
+UNITIZED_INLINE void MappedFile::close() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapped) munmap(const_cast<char*>(data), size);
+#endif
+    buffer.clear();
+    buffer.shrink_to_fit();
+    data = nullptr;
+    size = 0;
+    mapped = false;
+    opened = false;
+}
+
+UNITIZED_INLINE bool MappedFile::isOpen() const noexcept {
+    return opened;
+}
+
+UNITIZED_INLINE std::string_view MappedFile::text() const noexcept {
+    return std::string_view(data, size);
+}
+
+} // namespace unitized
@@ -0,0 +1,100 @@
+#ifndef UNITIZED_PACKED_H
+#define UNITIZED_PACKED_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace unitized {
+
+namespace detail {
+
+template <class Runtime>
+struct PackedTraits;
+
+template <>
+struct PackedTraits<Length> {
+    static constexpr int MaxUnit = Length::Miles;
+};
+
+template <>
+struct PackedTraits<Angle> {
+    static constexpr int MaxUnit = Angle::PercentGrade;
+};
+
+} // namespace detail
+
+// A Length or Angle in 8 bytes instead of 16, for structs of many of them
+// that can't be split into LengthArray or AngleArray columns.  The unit is
+// kept in the low 3 bits of the double's mantissa, so decoding is a mask for
+// the value and a mask for the unit.
+//
+// The value keeps 50 significant bits instead of 53: it is rounded to the
+// nearest multiple of 8 ulps, a relative error of at most 2^-50 (about
+// 8.9e-16, or 0.9 nm in 1000 km).  Values with at most 50 significant bits,
+// such as integers below 2^50 and short binary fractions like 10.25, are
+// exact; 0.1 is not.  Subnormals are off by at most 2^-1072.  Infinities,
+// zeros and NaN survive, but NaN payloads don't.
+template <class Runtime>
+class Packed
+{
+    static constexpr std::uint64_t UnitMask = 7;
+    static_assert(detail::PackedTraits<Runtime>::MaxUnit <= int(UnitMask), "units must fit in the tag bits");
+
+public:
+    typedef typename Runtime::Unit Unit;
+
+    Packed() = default;
+    explicit Packed(Runtime quantity) noexcept: bits(pack(quantity.convertTo(quantity.unit), quantity.unit)) {}
+    Packed(double value, Unit unit) noexcept: bits(pack(value, unit)) {}
+
+    Unit unit() const noexcept { return static_cast<Unit>(bits & UnitMask); }
+    // The value in unit(), after rounding.
+    double value() const noexcept {
+        std::uint64_t valueBits = bits & ~UnitMask;
+        double value;
+        std::memcpy(&value, &valueBits, sizeof value);
+        return value;
+    }
+
+    Runtime get() const noexcept { return Runtime(value(), unit()); }
+    operator Runtime() const noexcept { return get(); }
+
+    // The raw encoding, for hashing or storing.
+    std::uint64_t encoding() const noexcept { return bits; }
+
+private:
+    std::uint64_t bits;
+
+    static std::uint64_t pack(double value, Unit unit) noexcept {
+        if (std::isnan(value)) value = std::numeric_limits<double>::quiet_NaN();
+        std::uint64_t valueBits;
+        std::memcpy(&valueBits, &value, sizeof valueBits);
+        // Rounding the magnitude half away from zero may carry into the
+        // exponent, which is still the nearest neighbor unless it reaches
+        // infinity.  Infinities and NaN just lose their low bits.
+        const std::uint64_t exponentMask = 0x7ff0000000000000;
+        std::uint64_t rounded = (valueBits + (UnitMask + 1) / 2) & ~UnitMask;
+        if (!std::isfinite(value) || (rounded & exponentMask) == exponentMask) {
+            rounded = valueBits & ~UnitMask;
+        }
+        return rounded | static_cast<std::uint64_t>(unit);
+    }
+};
+
+typedef Packed<Length> PackedLength;
+typedef Packed<Angle> PackedAngle;
+
+static_assert(sizeof(PackedLength) == 8, "PackedLength must fit in 8 bytes");
+static_assert(sizeof(PackedAngle) == 8, "PackedAngle must fit in 8 bytes");
+static_assert(std::is_trivially_copyable<PackedLength>::value, "PackedLength must be trivially copyable");
+static_assert(std::is_trivially_copyable<PackedAngle>::value, "PackedAngle must be trivially copyable");
+
+} // namespace unitized
+
+#endif // UNITIZED_PACKED_H
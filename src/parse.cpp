@@ -0,0 +1,5 @@
+#include "parse.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "parse.inl"
+#endif
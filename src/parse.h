@@ -0,0 +1,57 @@
+#ifndef UNITIZED_PARSE_H
+#define UNITIZED_PARSE_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include <string_view>
+
+namespace unitized {
+
+enum class ParseError {
+    None = 0,
+    // no number where one was expected
+    InvalidNumber,
+    // letters after a number that aren't a unit
+    UnknownUnit,
+    // a number too large for a double, or minutes or seconds not below 60
+    OutOfRange
+};
+
+// Like std::from_chars_result: ptr is one past the last character parsed,
+// or where the error was found.
+struct ParseResult {
+    const char* ptr;
+    ParseError error;
+
+    explicit operator bool() const noexcept { return error == ParseError::None; }
+};
+
+// Parses a Length from the start of text, without allocating:
+//
+//   12.5ft  12.5 feet  -3m  1e3 km  42 (in defaultUnit)
+//   3m 20cm  5ft 3in  5' 3"  5'3  (compound, in the first part's unit)
+//
+// Units are whatever Length::parseUnit accepts, and ' and " for feet and
+// inches.  A bare number after feet is inches.  A sign applies to the whole
+// value.  Parsing stops at the first character that doesn't continue the
+// value; length is only assigned on success.
+UNITIZED_INLINE ParseResult parse(std::string_view text, Length& length,
+                                  Length::Unit defaultUnit = Length::Meters) noexcept;
+
+// Parses an Angle the same way:
+//
+//   45deg  45°  100 grad  1.2rad  1600 mils  12%  (percent grade)
+//   45°30'15"  45°30.5'  -12d 30'  (degrees, minutes and seconds)
+//
+// Minutes and seconds must be below 60, and the result is in degrees.
+UNITIZED_INLINE ParseResult parse(std::string_view text, Angle& angle,
+                                  Angle::Unit defaultUnit = Angle::Degrees) noexcept;
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "parse.inl"
+#endif
+
+#endif // UNITIZED_PARSE_H
@@ -0,0 +1,152 @@
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+
+namespace unitized {
+
+namespace detail {
+
+// Symbols may follow a number with no space and match as a prefix, while
+// names must be the whole run of letters after the number.
+inline constexpr UnitName LengthSymbols[] = {{"'", Length::Feet}, {"\"", Length::Inches}};
+inline constexpr UnitName AngleSymbols[] = {{"\xc2\xb0", Angle::Degrees}, {"%", Angle::PercentGrade}};
+
+// The UTF-8 prime and double prime signs.
+inline constexpr std::string_view PrimeSign = "\xe2\x80\xb2";
+inline constexpr std::string_view DoublePrimeSign = "\xe2\x80\xb3";
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+inline bool isLetter(char c) {
+    return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+inline const char* skipSpaces(const char* p, const char* last) {
+    while (p != last && isSpace(*p)) p++;
+    return p;
+}
+// The end of symbol if [p, last) starts with it, otherwise p.
+inline const char* skipSymbol(const char* p, const char* last, std::string_view symbol) {
+    return std::string_view(p, last - p).substr(0, symbol.size()) == symbol ? p + symbol.size() : p;
+}
+
+// An unsigned number; signs are handled once for the whole value.
+inline ParseResult parseNumber(const char* p, const char* last, double& value) {
+    if (p == last || !((*p >= '0' && *p <= '9') || *p == '.')) return {p, ParseError::InvalidNumber};
+    std::from_chars_result result = std::from_chars(p, last, value);
+    if (result.ec == std::errc::invalid_argument) return {p, ParseError::InvalidNumber};
+    if (result.ec == std::errc::result_out_of_range) return {p, ParseError::OutOfRange};
+    return {result.ptr, ParseError::None};
+}
+
+// A number and its unit, or -1 for none, in which case spaces after the
+// number aren't consumed.
+template <std::size_t N, class ParseUnit>
+inline ParseResult parsePart(const char* p, const char* last, const UnitName (&symbols)[N],
+                             ParseUnit parseUnit, double& value, int& unit) {
+    ParseResult number = parseNumber(p, last, value);
+    if (number.error != ParseError::None) return number;
+    const char* q = skipSpaces(number.ptr, last);
+    for (const UnitName& symbol : symbols) {
+        const char* end = skipSymbol(q, last, symbol.name);
+        if (end != q) {
+            unit = symbol.unit;
+            return {end, ParseError::None};
+        }
+    }
+    const char* end = q;
+    while (end != last && isLetter(*end)) end++;
+    if (end == q) {
+        unit = -1;
+        return number;
+    }
+    unit = parseUnit(std::string_view(q, end - q));
+    if (!unit) return {q, ParseError::UnknownUnit};
+    return {end, ParseError::None};
+}
+
+// Minutes or seconds: a number below 60 followed by one of the signs.
+inline ParseResult parseSexagesimal(const char* p, const char* last, std::string_view sign,
+                                    std::string_view alternative, double& value) {
+    ParseResult number = parseNumber(p, last, value);
+    if (number.error != ParseError::None) return number;
+    const char* end = skipSymbol(number.ptr, last, sign);
+    if (end == number.ptr) end = skipSymbol(number.ptr, last, alternative);
+    if (end == number.ptr) return {number.ptr, ParseError::InvalidNumber};
+    if (!(value < 60)) return {p, ParseError::OutOfRange};
+    return {end, ParseError::None};
+}
+
+} // namespace detail
+
+UNITIZED_INLINE ParseResult parse(std::string_view text, Length& length, Length::Unit defaultUnit) noexcept {
+    const char* p = text.data();
+    const char* last = p + text.size();
+    bool negative = p != last && *p == '-';
+    if (p != last && (*p == '-' || *p == '+')) p++;
+
+    double value;
+    int unit;
+    ParseResult part = detail::parsePart(p, last, detail::LengthSymbols, Length::parseUnit, value, unit);
+    if (part.error != ParseError::None) return part;
+    if (unit < 0) {
+        length = Length(negative ? -value : value, defaultUnit);
+        return part;
+    }
+
+    // Further parts need a unit, except inches after feet.  One that doesn't
+    // parse ends the value before it.
+    Length total(value, static_cast<Length::Unit>(unit));
+    p = part.ptr;
+    for (int previous = unit;; previous = unit) {
+        const char* next = detail::skipSpaces(p, last);
+        part = detail::parsePart(next, last, detail::LengthSymbols, Length::parseUnit, value, unit);
+        if (part.error != ParseError::None) break;
+        if (unit < 0) {
+            if (previous != Length::Feet) break;
+            unit = Length::Inches;
+        }
+        total = total.add(Length(value, static_cast<Length::Unit>(unit)));
+        p = part.ptr;
+    }
+    length = negative ? total.negate() : total;
+    return {p, ParseError::None};
+}
+
+UNITIZED_INLINE ParseResult parse(std::string_view text, Angle& angle, Angle::Unit defaultUnit) noexcept {
+    const char* p = text.data();
+    const char* last = p + text.size();
+    bool negative = p != last && *p == '-';
+    if (p != last && (*p == '-' || *p == '+')) p++;
+
+    double value;
+    int unit;
+    ParseResult part = detail::parsePart(p, last, detail::AngleSymbols, Angle::parseUnit, value, unit);
+    if (part.error != ParseError::None) return part;
+    p = part.ptr;
+    if (unit == Angle::Degrees) {
+        // minutes, then seconds; either may be left out
+        double minutes = 0, seconds = 0;
+        const char* next = detail::skipSpaces(p, last);
+        ParseResult minutesPart = detail::parseSexagesimal(next, last, "'", detail::PrimeSign, minutes);
+        if (minutesPart.error == ParseError::OutOfRange) return minutesPart;
+        if (minutesPart.error == ParseError::None) {
+            p = minutesPart.ptr;
+            next = detail::skipSpaces(p, last);
+        } else {
+            minutes = 0;
+        }
+        ParseResult secondsPart = detail::parseSexagesimal(next, last, "\"", detail::DoublePrimeSign, seconds);
+        if (secondsPart.error == ParseError::OutOfRange) return secondsPart;
+        if (secondsPart.error == ParseError::None) {
+            p = secondsPart.ptr;
+        } else {
+            seconds = 0;
+        }
+        value += (minutes + seconds / 60) / 60;
+    }
+    angle = Angle(negative ? -value : value, unit < 0 ? defaultUnit : static_cast<Angle::Unit>(unit));
+    return {p, ParseError::None};
+}
+
+} // namespace unitized
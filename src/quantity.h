@@ -0,0 +1,198 @@
+#ifndef UNITIZED_QUANTITY_H
+#define UNITIZED_QUANTITY_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include <type_traits>
+
+namespace unitized {
+
+// What a Quantity measures: its unit enum, the runtime class it converts to
+// (if any), the constant factors between its units, and its power of length
+// (0 for angles), which multiplication and division check at compile time.
+struct LengthDimension {
+    typedef Length::Unit Unit;
+    typedef Length Runtime;
+    static constexpr int lengthPower = 1;
+
+    static constexpr bool isLinear(Unit) { return true; }
+    static constexpr double factor(Unit from, Unit to) { return Length::conversionFactor(from, to); }
+};
+
+struct AngleDimension {
+    typedef Angle::Unit Unit;
+    typedef Angle Runtime;
+    static constexpr int lengthPower = 0;
+
+    static constexpr bool isLinear(Unit unit) { return unit != Angle::PercentGrade; }
+    static constexpr double factor(Unit from, Unit to) { return Angle::conversionFactor(from, to); }
+};
+
+// Areas and volumes have a unit for the square or cube of each Length unit,
+// with the same enum values, so products of lengths keep their unit.
+struct AreaDimension {
+    enum Unit {
+        SquareMeters = Length::Meters,
+        SquareCentimeters = Length::Centimeters,
+        SquareKilometers = Length::Kilometers,
+        SquareFeet = Length::Feet,
+        SquareYards = Length::Yards,
+        SquareInches = Length::Inches,
+        SquareMiles = Length::Miles
+    };
+    static constexpr int lengthPower = 2;
+
+    static constexpr bool isLinear(Unit) { return true; }
+    static constexpr double factor(Unit from, Unit to) {
+        double linear = LengthDimension::factor(static_cast<Length::Unit>(from), static_cast<Length::Unit>(to));
+        return linear * linear;
+    }
+};
+
+struct VolumeDimension {
+    enum Unit {
+        CubicMeters = Length::Meters,
+        CubicCentimeters = Length::Centimeters,
+        CubicKilometers = Length::Kilometers,
+        CubicFeet = Length::Feet,
+        CubicYards = Length::Yards,
+        CubicInches = Length::Inches,
+        CubicMiles = Length::Miles
+    };
+    static constexpr int lengthPower = 3;
+
+    static constexpr bool isLinear(Unit) { return true; }
+    static constexpr double factor(Unit from, Unit to) {
+        double linear = LengthDimension::factor(static_cast<Length::Unit>(from), static_cast<Length::Unit>(to));
+        return linear * linear * linear;
+    }
+};
+
+template <int LengthPower>
+struct DimensionOfLengthPower;
+template <>
+struct DimensionOfLengthPower<1> { typedef LengthDimension type; };
+template <>
+struct DimensionOfLengthPower<2> { typedef AreaDimension type; };
+template <>
+struct DimensionOfLengthPower<3> { typedef VolumeDimension type; };
+
+// A value whose unit is part of its type, for code that knows its units at
+// compile time.  It is just a Rep: same-unit arithmetic compiles to the same
+// instructions as on a raw Rep, and conversions between units multiply by a
+// constant folded at compile time.  Lengths and angles convert implicitly to
+// the runtime Length or Angle, and explicitly back.
+template <class Dimension, typename Dimension::Unit U, class Rep = double>
+class Quantity
+{
+    static_assert(Dimension::isLinear(U), "Quantity units must convert with a constant factor");
+
+public:
+    typedef Dimension dimension;
+    typedef Rep rep;
+    static constexpr typename Dimension::Unit unit = U;
+
+    constexpr Quantity() noexcept: value() {}
+    constexpr explicit Quantity(Rep value) noexcept: value(value) {}
+    template <typename Dimension::Unit From, class FromRep>
+    constexpr Quantity(const Quantity<Dimension, From, FromRep>& other) noexcept:
+        value(static_cast<Rep>(other.count() * Dimension::factor(From, U))) {}
+    // D defers the lookup of Runtime, which areas and volumes don't have.
+    template <class D = Dimension>
+    UNITIZED_CONSTEXPR explicit Quantity(const typename D::Runtime& other) noexcept:
+        value(static_cast<Rep>(other.convertTo(U))) {}
+
+    constexpr Rep count() const noexcept { return value; }
+
+    template <class D = Dimension>
+    UNITIZED_CONSTEXPR operator typename D::Runtime() const noexcept {
+        return typename D::Runtime(static_cast<double>(value), U);
+    }
+
+    constexpr Quantity operator+() const noexcept { return *this; }
+    constexpr Quantity operator-() const noexcept { return Quantity(-value); }
+
+    constexpr Quantity& operator+=(Quantity other) noexcept { value += other.value; return *this; }
+    constexpr Quantity& operator-=(Quantity other) noexcept { value -= other.value; return *this; }
+    constexpr Quantity& operator*=(Rep factor) noexcept { value *= factor; return *this; }
+    constexpr Quantity& operator/=(Rep denominator) noexcept { value /= denominator; return *this; }
+
+    friend constexpr Quantity operator+(Quantity a, Quantity b) noexcept { return Quantity(a.value + b.value); }
+    friend constexpr Quantity operator-(Quantity a, Quantity b) noexcept { return Quantity(a.value - b.value); }
+    friend constexpr Quantity operator*(Quantity a, Rep factor) noexcept { return Quantity(a.value * factor); }
+    friend constexpr Quantity operator*(Rep factor, Quantity a) noexcept { return Quantity(factor * a.value); }
+    friend constexpr Quantity operator/(Quantity a, Rep denominator) noexcept { return Quantity(a.value / denominator); }
+    friend constexpr Rep operator/(Quantity a, Quantity b) noexcept { return a.value / b.value; }
+
+    friend constexpr bool operator==(Quantity a, Quantity b) noexcept { return a.value == b.value; }
+    friend constexpr bool operator!=(Quantity a, Quantity b) noexcept { return a.value != b.value; }
+    friend constexpr bool operator<(Quantity a, Quantity b) noexcept { return a.value < b.value; }
+    friend constexpr bool operator<=(Quantity a, Quantity b) noexcept { return a.value <= b.value; }
+    friend constexpr bool operator>(Quantity a, Quantity b) noexcept { return a.value > b.value; }
+    friend constexpr bool operator>=(Quantity a, Quantity b) noexcept { return a.value >= b.value; }
+
+private:
+    Rep value;
+};
+
+// Mixed units of one dimension convert the right side to the left's unit.
+template <class Dimension, typename Dimension::Unit U, typename Dimension::Unit V, class Rep>
+constexpr Quantity<Dimension, U, Rep> operator+(Quantity<Dimension, U, Rep> a, Quantity<Dimension, V, Rep> b) noexcept {
+    return a + Quantity<Dimension, U, Rep>(b);
+}
+template <class Dimension, typename Dimension::Unit U, typename Dimension::Unit V, class Rep>
+constexpr Quantity<Dimension, U, Rep> operator-(Quantity<Dimension, U, Rep> a, Quantity<Dimension, V, Rep> b) noexcept {
+    return a - Quantity<Dimension, U, Rep>(b);
+}
+template <class Dimension, typename Dimension::Unit U, typename Dimension::Unit V, class Rep>
+constexpr Rep operator/(Quantity<Dimension, U, Rep> a, Quantity<Dimension, V, Rep> b) noexcept {
+    return a / Quantity<Dimension, U, Rep>(b);
+}
+
+// Products and quotients of lengths, areas and volumes, in the left side's
+// unit.  Other combinations, and sums of different dimensions, don't compile.
+template <class D1, typename D1::Unit U, class D2, typename D2::Unit V, class Rep,
+          int Power = D1::lengthPower + D2::lengthPower,
+          class Result = typename DimensionOfLengthPower<Power>::type>
+constexpr typename std::enable_if<(D1::lengthPower > 0 && D2::lengthPower > 0),
+                                  Quantity<Result, static_cast<typename Result::Unit>(U), Rep>>::type
+operator*(Quantity<D1, U, Rep> a, Quantity<D2, V, Rep> b) noexcept {
+    typedef Quantity<D2, static_cast<typename D2::Unit>(U), Rep> Right;
+    return Quantity<Result, static_cast<typename Result::Unit>(U), Rep>(a.count() * Right(b).count());
+}
+template <class D1, typename D1::Unit U, class D2, typename D2::Unit V, class Rep,
+          int Power = D1::lengthPower - D2::lengthPower,
+          class Result = typename DimensionOfLengthPower<Power>::type>
+constexpr typename std::enable_if<(D2::lengthPower > 0),
+                                  Quantity<Result, static_cast<typename Result::Unit>(U), Rep>>::type
+operator/(Quantity<D1, U, Rep> a, Quantity<D2, V, Rep> b) noexcept {
+    typedef Quantity<D2, static_cast<typename D2::Unit>(U), Rep> Right;
+    return Quantity<Result, static_cast<typename Result::Unit>(U), Rep>(a.count() / Right(b).count());
+}
+
+#define UNITIZED_QUANTITY_COMPARISON(op) \
+    template <class Dimension, typename Dimension::Unit U, typename Dimension::Unit V, class Rep> \
+    constexpr bool operator op(Quantity<Dimension, U, Rep> a, Quantity<Dimension, V, Rep> b) noexcept { \
+        return a op Quantity<Dimension, U, Rep>(b); \
+    }
+UNITIZED_QUANTITY_COMPARISON(==)
+UNITIZED_QUANTITY_COMPARISON(!=)
+UNITIZED_QUANTITY_COMPARISON(<)
+UNITIZED_QUANTITY_COMPARISON(<=)
+UNITIZED_QUANTITY_COMPARISON(>)
+UNITIZED_QUANTITY_COMPARISON(>=)
+#undef UNITIZED_QUANTITY_COMPARISON
+
+template <Length::Unit U, class Rep = double>
+using LengthIn = Quantity<LengthDimension, U, Rep>;
+template <Angle::Unit U, class Rep = double>
+using AngleIn = Quantity<AngleDimension, U, Rep>;
+template <AreaDimension::Unit U, class Rep = double>
+using AreaIn = Quantity<AreaDimension, U, Rep>;
+template <VolumeDimension::Unit U, class Rep = double>
+using VolumeIn = Quantity<VolumeDimension, U, Rep>;
+
+} // namespace unitized
+
+#endif // UNITIZED_QUANTITY_H
@@ -0,0 +1,5 @@
+#include "simd.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "simd.inl"
+#endif
@@ -0,0 +1,136 @@
+#ifndef UNITIZED_SIMD_H
+#define UNITIZED_SIMD_H
+
+#include "unitizedglobal.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace unitized {
+namespace simd {
+
+// Instruction sets the batch kernels are compiled for.  Every build contains
+// the Scalar kernels; the others exist on x86 and are only used when cpuid
+// reports support for them.
+enum Isa {
+    Scalar = 0,
+    SSE2 = 1,
+    AVX2 = 2,   // AVX2 + FMA
+    AVX512 = 3  // AVX-512F
+};
+
+// The batch kernels for one instruction set.  in and out may be the same
+// array but must not otherwise overlap.
+struct Kernels {
+    Isa isa;
+    // out[i] = in[i] * factor
+    void (*scale)(const double* in, double* out, std::size_t n, double factor);
+
+    // Trigonometry in radians, with the worst error measured against the
+    // exact result.  sin, cos and tan hand |x| > 65536 to libm.
+    void (*sin)(const double* in, double* out, std::size_t n);    // < 2 ulp
+    void (*cos)(const double* in, double* out, std::size_t n);    // < 2 ulp
+    void (*tan)(const double* in, double* out, std::size_t n);    // < 3.5 ulp
+    void (*asin)(const double* in, double* out, std::size_t n);   // < 2.5 ulp
+    void (*acos)(const double* in, double* out, std::size_t n);   // < 2.5 ulp
+    void (*atan)(const double* in, double* out, std::size_t n);   // < 2 ulp
+    void (*atan2)(const double* y, const double* x, double* out, std::size_t n); // < 2 ulp
+    // sin and cos from one range reduction, each as accurate as above.
+    void (*sincos)(const double* in, double* sin, double* cos, std::size_t n);
+
+    // The same for angles in a unit with quarterTurn units per right angle
+    // (90 for degrees, 100 for gradians, 1600 for NATO mils), reduced exactly
+    // in that unit, so multiples of a right angle give exact results.
+    void (*nativeSin)(const double* in, double* out, std::size_t n, double quarterTurn);
+    void (*nativeCos)(const double* in, double* out, std::size_t n, double quarterTurn);
+    void (*nativeTan)(const double* in, double* out, std::size_t n, double quarterTurn);
+    void (*nativeSincos)(const double* in, double* sin, double* cos, std::size_t n, double quarterTurn);
+
+    // Survey shots to deltas, with the distance times distanceFactor:
+    //   east = distance * cos(inclination) * sin(azimuth)
+    //   north = distance * cos(inclination) * cos(azimuth)
+    //   up = distance * sin(inclination)
+    // Each angle is in radians if its quarterTurn is 0 and otherwise reduced
+    // like the native kernels.
+    void (*shotDeltas)(const double* distance, const double* azimuth, const double* inclination,
+                       double* east, double* north, double* up, std::size_t n,
+                       double distanceFactor, double azimuthQuarterTurn, double inclinationQuarterTurn);
+    // The inverse: distance = hypot(east, north, up) * distanceFactor,
+    // azimuth = atan2(east, north) * azimuthFactor wrapped into [0, fullTurn)
+    // (0 for vertical shots) and inclination = atan2(up, hypot(east, north))
+    // * inclinationFactor.
+    void (*deltaShots)(const double* east, const double* north, const double* up,
+                       double* distance, double* azimuth, double* inclination, std::size_t n,
+                       double distanceFactor, double azimuthFactor, double inclinationFactor, double fullTurn);
+
+    // Adds in to the compensated total sum + compensation, with Neumaier
+    // summation in independent accumulators per lane.
+    void (*sum)(const double* in, std::size_t n, double& sum, double& compensation);
+    // Compensated running sum, continuing the total sum + compensation
+    // through in and writing out[i] = total * factor + offset after each
+    // element.  Packs are scanned in registers and carried into each other.
+    void (*prefixSum)(const double* in, double* out, std::size_t n, double& sum, double& compensation,
+                      double factor, double offset);
+
+    // Writes the offset of every delimiter and newline in text[0, n), in
+    // order, to positions, which must have room for n, and returns how many
+    // there were.  n must be below 2^32.
+    std::size_t (*findSeparators)(const char* text, std::size_t n, char delimiter, std::uint32_t* positions);
+};
+
+// Single-precision kernels for the same instruction sets, with twice the
+// lanes per pack.  sin and cos stay within 2.5 ulp of float, and tan within
+// 4, for |x| up to 8192 radians and native values up to 2^20 units, beyond
+// which lanes are computed in double and rounded.
+struct FloatKernels {
+    Isa isa;
+    // out[i] = in[i] * factor, within an ulp.
+    void (*scale)(const float* in, float* out, std::size_t n, double factor);
+    // out[i] = in[i] * factor, computed in double and rounded once to float.
+    // Returns how many finite values overflowed to infinity or nonzero ones
+    // underflowed to zero.
+    std::size_t (*narrow)(const double* in, float* out, std::size_t n, double factor);
+    // out[i] = in[i] * factor, exactly widened before the multiply.
+    void (*widen)(const float* in, double* out, std::size_t n, double factor);
+
+    void (*sin)(const float* in, float* out, std::size_t n);
+    void (*cos)(const float* in, float* out, std::size_t n);
+    void (*tan)(const float* in, float* out, std::size_t n);
+    void (*sincos)(const float* in, float* sin, float* cos, std::size_t n);
+
+    // Reduced exactly in a unit with an integral quarterTurn, like the
+    // double native kernels.
+    void (*nativeSin)(const float* in, float* out, std::size_t n, float quarterTurn);
+    void (*nativeCos)(const float* in, float* out, std::size_t n, float quarterTurn);
+    void (*nativeTan)(const float* in, float* out, std::size_t n, float quarterTurn);
+    void (*nativeSincos)(const float* in, float* sin, float* cos, std::size_t n, float quarterTurn);
+};
+
+// The best instruction set this CPU (and OS) supports.
+UNITIZED_INLINE Isa detectIsa() noexcept;
+UNITIZED_INLINE bool isSupported(Isa isa) noexcept;
+
+// The kernels for a specific instruction set, which must be supported.
+UNITIZED_INLINE const Kernels& kernels(Isa isa) noexcept;
+// The kernels for detectIsa(), resolved once on first use.
+UNITIZED_INLINE const Kernels& kernels() noexcept;
+UNITIZED_INLINE const FloatKernels& floatKernels(Isa isa) noexcept;
+UNITIZED_INLINE const FloatKernels& floatKernels() noexcept;
+
+// The scalar sincos kernel, for a single value in radians.
+UNITIZED_INLINE void sincos(double radians, double& sin, double& cos) noexcept;
+
+// Scalar trigonometry in a unit with quarterTurn units per right angle.  The
+// value is reduced exactly with fmod, so libm only sees |x| <= pi/4.
+UNITIZED_INLINE double nativeSin(double value, double quarterTurn) noexcept;
+UNITIZED_INLINE double nativeCos(double value, double quarterTurn) noexcept;
+UNITIZED_INLINE double nativeTan(double value, double quarterTurn) noexcept;
+UNITIZED_INLINE void nativeSincos(double value, double quarterTurn, double& sin, double& cos) noexcept;
+
+} // namespace simd
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "simd.inl"
+#endif
+
+#endif // UNITIZED_SIMD_H
@@ -0,0 +1,600 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define UNITIZED_SIMD_X86
+#  include <immintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  endif
+#endif
+
+// The kernels for each instruction set are compiled from the same source,
+// simdkernels.inl, inside a region that enables that instruction set, so one
+// build runs on any x86 host.  MSVC allows the intrinsics without this.
+#if defined(__clang__)
+#  define UNITIZED_SIMD_BEGIN(isa) _Pragma(UNITIZED_SIMD_STRINGIFY(clang attribute push(__attribute__((target(isa))), apply_to = function)))
+#  define UNITIZED_SIMD_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#  define UNITIZED_SIMD_BEGIN(isa) _Pragma("GCC push_options") _Pragma(UNITIZED_SIMD_STRINGIFY(GCC target(isa)))
+#  define UNITIZED_SIMD_END _Pragma("GCC pop_options")
+#else
+#  define UNITIZED_SIMD_BEGIN(isa)
+#  define UNITIZED_SIMD_END
+#endif
+#define UNITIZED_SIMD_STRINGIFY(x) #x
+
+namespace unitized {
+namespace simd {
+namespace detail {
+
+// Adding and subtracting 1.5 * 2^52 rounds to the nearest integer.
+inline constexpr double RoundMagic = 6755399441055744.0;
+
+// Cody-Waite split of pi/2; the first two parts times any reduction
+// multiple below TrigLimit are exact.
+inline constexpr double PiOver2A = 1.5707962512969971;
+inline constexpr double PiOver2B = 7.5497894158615964e-08;
+inline constexpr double PiOver2C = 5.390302858158119e-15;
+inline constexpr double PiOver2 = 1.5707963267948966;
+inline constexpr double PiOver4 = 0.78539816339744831;
+inline constexpr double Pi = 3.1415926535897931;
+// The low-order bits of PiOver2 (atan's MOREBITS).
+inline constexpr double PiOver2Low = 6.123233995736765886130e-17;
+inline constexpr double TwoOverPi = 0.63661977236758134;
+// Beyond this many radians the vector sin/cos/tan hand the lane to libm.
+inline constexpr double TrigLimit = 65536.0;
+// Beyond this the native reductions are no longer exact.
+inline constexpr double NativeLimit = 1099511627776.0; // 2^40
+// Between these, sums of three squares neither overflow nor lose precision
+// to subnormals.
+inline constexpr double HypotMin = 0x1p-500;
+inline constexpr double HypotMax = 0x1p500;
+
+// The same for the float kernels.  Float needs a four-part split of pi/2:
+// the first three parts have 8, 11 and 11 significant bits, so their products
+// with reduction multiples below TrigLimitF are exact even without FMA.
+inline constexpr float RoundMagicF = 12582912.0f; // 1.5 * 2^23
+inline constexpr float PiOver2AF = 1.5703125f;
+inline constexpr float PiOver2BF = 4.837512969970703125e-4f;
+inline constexpr float PiOver2CF = 7.549533620476723e-8f;
+inline constexpr float PiOver2DF = 2.5633440682570896e-12f;
+inline constexpr float TwoOverPiF = 0.636619772f;
+inline constexpr float TrigLimitF = 8192.0f;
+inline constexpr float NativeLimitF = 1048576.0f; // 2^20
+
+// The index of the lowest set bit of a nonzero mask.
+inline unsigned countTrailingZeros(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return index;
+#else
+    unsigned index = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// Neumaier's compensated addition: sum + compensation is the exact total,
+// up to the rounding of compensation itself.
+inline void addCompensated(double& sum, double& compensation, double x) {
+    double t = sum + x;
+    compensation += std::fabs(sum) >= std::fabs(x) ? (sum - t) + x : (x - t) + sum;
+    sum = t;
+}
+
+// Reduces value in a unit with quarterTurn units per right angle to radians
+// in [-pi/4, pi/4] and its quadrant, 0 to 3.
+inline double reduceNative(double value, double quarterTurn, int& quadrant) {
+    quadrant = 0;
+    if (!(std::fabs(value) < HUGE_VAL)) return value - value;
+    double x = std::fmod(value, 4 * quarterTurn);
+    double n = std::nearbyint(x / quarterTurn);
+    quadrant = static_cast<int>(n) & 3;
+    return (x - n * quarterTurn) * (PiOver2 / quarterTurn);
+}
+
+namespace scalar {
+
+struct Pack {
+    typedef double V;
+    typedef bool M;
+    static constexpr std::size_t width = 1;
+
+    static inline V load(const double* p) { return *p; }
+    static inline void store(double* p, V v) { *p = v; }
+    static inline V set1(double v) { return v; }
+    static inline V add(V a, V b) { return a + b; }
+    static inline V sub(V a, V b) { return a - b; }
+    static inline V mul(V a, V b) { return a * b; }
+    static inline V div(V a, V b) { return a / b; }
+    static inline V fma(V a, V b, V c) { return a * b + c; }
+    static inline V sqrt(V a) { return std::sqrt(a); }
+    // Like minpd/maxpd, these return b if either is NaN.
+    static inline V min(V a, V b) { return a < b ? a : b; }
+    static inline V max(V a, V b) { return a > b ? a : b; }
+    static inline V abs(V a) { return std::fabs(a); }
+    static inline V neg(V a) { return -a; }
+    static inline V copysign(V magnitude, V sign) { return std::copysign(magnitude, sign); }
+    static inline V round(V a) { return (a + RoundMagic) - RoundMagic; }
+    static inline M lt(V a, V b) { return a < b; }
+    static inline M le(V a, V b) { return a <= b; }
+    static inline M eq(V a, V b) { return a == b; }
+    static inline M both(M a, M b) { return a && b; }
+    static inline M either(M a, M b) { return a || b; }
+    static inline V select(M m, V a, V b) { return m ? a : b; }
+    static inline bool all(M m) { return m; }
+    // Lane i gets lane i - lanes, or zero below lanes.
+    template <std::size_t lanes>
+    static inline V shiftUp(V) { return 0; }
+    static inline V broadcastLast(V a) { return a; }
+};
+
+// Byte comparisons for the text kernels: bit i of match is set where p[i]
+// is a or b.
+struct Bytes {
+    static constexpr std::size_t width = 8;
+
+    static inline std::uint64_t match(const char* p, char a, char b) {
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < width; i++) mask |= std::uint64_t(p[i] == a || p[i] == b) << i;
+        return mask;
+    }
+};
+
+#include "simdkernels.inl"
+
+namespace f32 {
+
+struct Pack {
+    typedef float V;
+    typedef bool M;
+    static constexpr std::size_t width = 1;
+
+    static inline V load(const float* p) { return *p; }
+    static inline void store(float* p, V v) { *p = v; }
+    static inline V set1(float v) { return v; }
+    static inline V add(V a, V b) { return a + b; }
+    static inline V sub(V a, V b) { return a - b; }
+    static inline V mul(V a, V b) { return a * b; }
+    static inline V div(V a, V b) { return a / b; }
+    static inline V fma(V a, V b, V c) { return a * b + c; }
+    static inline V abs(V a) { return std::fabs(a); }
+    static inline V round(V a) { return (a + RoundMagicF) - RoundMagicF; }
+    static inline M lt(V a, V b) { return a < b; }
+    static inline M le(V a, V b) { return a <= b; }
+    static inline M eq(V a, V b) { return a == b; }
+    static inline M either(M a, M b) { return a || b; }
+    static inline V select(M m, V a, V b) { return m ? a : b; }
+    static inline bool all(M m) { return m; }
+};
+
+#include "simdfloatkernels.inl"
+
+} // namespace f32
+
+} // namespace scalar
+
+#ifdef UNITIZED_SIMD_X86
+
+UNITIZED_SIMD_BEGIN("sse2")
+namespace sse2 {
+
+struct Pack {
+    typedef __m128d V;
+    typedef __m128d M;
+    static constexpr std::size_t width = 2;
+
+    static inline V load(const double* p) { return _mm_loadu_pd(p); }
+    static inline void store(double* p, V v) { _mm_storeu_pd(p, v); }
+    static inline V set1(double v) { return _mm_set1_pd(v); }
+    static inline V add(V a, V b) { return _mm_add_pd(a, b); }
+    static inline V sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static inline V mul(V a, V b) { return _mm_mul_pd(a, b); }
+    static inline V div(V a, V b) { return _mm_div_pd(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static inline V sqrt(V a) { return _mm_sqrt_pd(a); }
+    static inline V min(V a, V b) { return _mm_min_pd(a, b); }
+    static inline V max(V a, V b) { return _mm_max_pd(a, b); }
+    static inline V abs(V a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static inline V neg(V a) { return _mm_xor_pd(_mm_set1_pd(-0.0), a); }
+    static inline V copysign(V magnitude, V sign) {
+        return _mm_or_pd(abs(magnitude), _mm_and_pd(_mm_set1_pd(-0.0), sign));
+    }
+    // SSE2 has no roundpd
+    static inline V round(V a) { return _mm_sub_pd(_mm_add_pd(a, _mm_set1_pd(RoundMagic)), _mm_set1_pd(RoundMagic)); }
+    static inline M lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+    static inline M le(V a, V b) { return _mm_cmple_pd(a, b); }
+    static inline M eq(V a, V b) { return _mm_cmpeq_pd(a, b); }
+    static inline M both(M a, M b) { return _mm_and_pd(a, b); }
+    static inline M either(M a, M b) { return _mm_or_pd(a, b); }
+    static inline V select(M m, V a, V b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+    static inline bool all(M m) { return _mm_movemask_pd(m) == 0x3; }
+    template <std::size_t lanes>
+    static inline V shiftUp(V a) { return _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(a), 8 * lanes)); }
+    static inline V broadcastLast(V a) { return _mm_unpackhi_pd(a, a); }
+};
+
+struct Bytes {
+    static constexpr std::size_t width = 16;
+
+    static inline std::uint64_t match(const char* p, char a, char b) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(a)), _mm_cmpeq_epi8(v, _mm_set1_epi8(b)));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(m));
+    }
+};
+
+#include "simdkernels.inl"
+
+namespace f32 {
+
+struct Pack {
+    typedef __m128 V;
+    typedef __m128 M;
+    static constexpr std::size_t width = 4;
+
+    static inline V load(const float* p) { return _mm_loadu_ps(p); }
+    static inline void store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static inline V set1(float v) { return _mm_set1_ps(v); }
+    static inline V add(V a, V b) { return _mm_add_ps(a, b); }
+    static inline V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static inline V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static inline V div(V a, V b) { return _mm_div_ps(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline V abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static inline V round(V a) { return _mm_sub_ps(_mm_add_ps(a, _mm_set1_ps(RoundMagicF)), _mm_set1_ps(RoundMagicF)); }
+    static inline M lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+    static inline M le(V a, V b) { return _mm_cmple_ps(a, b); }
+    static inline M eq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+    static inline M either(M a, M b) { return _mm_or_ps(a, b); }
+    static inline V select(M m, V a, V b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static inline bool all(M m) { return _mm_movemask_ps(m) == 0xf; }
+};
+
+#include "simdfloatkernels.inl"
+
+} // namespace f32
+
+} // namespace sse2
+UNITIZED_SIMD_END
+
+UNITIZED_SIMD_BEGIN("avx2,fma")
+namespace avx2 {
+
+struct Pack {
+    typedef __m256d V;
+    typedef __m256d M;
+    static constexpr std::size_t width = 4;
+
+    static inline V load(const double* p) { return _mm256_loadu_pd(p); }
+    static inline void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    static inline V set1(double v) { return _mm256_set1_pd(v); }
+    static inline V add(V a, V b) { return _mm256_add_pd(a, b); }
+    static inline V sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static inline V mul(V a, V b) { return _mm256_mul_pd(a, b); }
+    static inline V div(V a, V b) { return _mm256_div_pd(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm256_fmadd_pd(a, b, c); }
+    static inline V sqrt(V a) { return _mm256_sqrt_pd(a); }
+    static inline V min(V a, V b) { return _mm256_min_pd(a, b); }
+    static inline V max(V a, V b) { return _mm256_max_pd(a, b); }
+    static inline V abs(V a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static inline V neg(V a) { return _mm256_xor_pd(_mm256_set1_pd(-0.0), a); }
+    static inline V copysign(V magnitude, V sign) {
+        return _mm256_or_pd(abs(magnitude), _mm256_and_pd(_mm256_set1_pd(-0.0), sign));
+    }
+    static inline V round(V a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline M lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static inline M le(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static inline M eq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static inline M both(M a, M b) { return _mm256_and_pd(a, b); }
+    static inline M either(M a, M b) { return _mm256_or_pd(a, b); }
+    static inline V select(M m, V a, V b) { return _mm256_blendv_pd(b, a, m); }
+    static inline bool all(M m) { return _mm256_movemask_pd(m) == 0xf; }
+    template <std::size_t lanes>
+    static inline V shiftUp(V a) {
+        // every lane below lanes takes lane 0 and is then cleared
+        constexpr int order = (lanes < 3 ? 3 - lanes : 0) << 6 | (lanes < 2 ? 2 - lanes : 0) << 4 |
+                              (lanes < 1 ? 1 - lanes : 0) << 2;
+        return _mm256_blend_pd(_mm256_permute4x64_pd(a, order), _mm256_setzero_pd(), (1 << lanes) - 1);
+    }
+    static inline V broadcastLast(V a) { return _mm256_permute4x64_pd(a, 0xff); }
+};
+
+struct Bytes {
+    static constexpr std::size_t width = 32;
+
+    static inline std::uint64_t match(const char* p, char a, char b) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(a)), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(b)));
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(m));
+    }
+};
+
+#include "simdkernels.inl"
+
+namespace f32 {
+
+struct Pack {
+    typedef __m256 V;
+    typedef __m256 M;
+    static constexpr std::size_t width = 8;
+
+    static inline V load(const float* p) { return _mm256_loadu_ps(p); }
+    static inline void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static inline V set1(float v) { return _mm256_set1_ps(v); }
+    static inline V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static inline V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static inline V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static inline V div(V a, V b) { return _mm256_div_ps(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+    static inline V abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static inline V round(V a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline M lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline M le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static inline M eq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static inline M either(M a, M b) { return _mm256_or_ps(a, b); }
+    static inline V select(M m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+    static inline bool all(M m) { return _mm256_movemask_ps(m) == 0xff; }
+};
+
+#include "simdfloatkernels.inl"
+
+} // namespace f32
+
+} // namespace avx2
+UNITIZED_SIMD_END
+
+// GCC before 12.3 warns spuriously inside the AVX-512 intrinsics (PR 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#  pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+UNITIZED_SIMD_BEGIN("avx512f,avx2,fma")
+namespace avx512 {
+
+struct Pack {
+    typedef __m512d V;
+    typedef __mmask8 M;
+    static constexpr std::size_t width = 8;
+
+    static inline V load(const double* p) { return _mm512_loadu_pd(p); }
+    static inline void store(double* p, V v) { _mm512_storeu_pd(p, v); }
+    static inline V set1(double v) { return _mm512_set1_pd(v); }
+    static inline V add(V a, V b) { return _mm512_add_pd(a, b); }
+    static inline V sub(V a, V b) { return _mm512_sub_pd(a, b); }
+    static inline V mul(V a, V b) { return _mm512_mul_pd(a, b); }
+    static inline V div(V a, V b) { return _mm512_div_pd(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm512_fmadd_pd(a, b, c); }
+    static inline V sqrt(V a) { return _mm512_sqrt_pd(a); }
+    static inline V min(V a, V b) { return _mm512_min_pd(a, b); }
+    static inline V max(V a, V b) { return _mm512_max_pd(a, b); }
+    // AVX-512F only has the bitwise operations on integer vectors
+    static inline V abs(V a) { return bits(_mm512_andnot_si512(signBit(), bits(a))); }
+    static inline V neg(V a) { return bits(_mm512_xor_si512(signBit(), bits(a))); }
+    static inline V copysign(V magnitude, V sign) {
+        return bits(_mm512_or_si512(bits(abs(magnitude)), _mm512_and_si512(signBit(), bits(sign))));
+    }
+    static inline V round(V a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline M lt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static inline M le(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static inline M eq(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static inline M both(M a, M b) { return a & b; }
+    static inline M either(M a, M b) { return a | b; }
+    static inline V select(M m, V a, V b) { return _mm512_mask_blend_pd(m, b, a); }
+    static inline bool all(M m) { return m == 0xff; }
+    template <std::size_t lanes>
+    static inline V shiftUp(V a) {
+        return bits(_mm512_alignr_epi64(bits(a), _mm512_setzero_si512(), 8 - lanes));
+    }
+    static inline V broadcastLast(V a) { return _mm512_permutexvar_pd(_mm512_set1_epi64(7), a); }
+
+    static inline __m512i signBit() { return _mm512_set1_epi64(0x8000000000000000LL); }
+    static inline __m512i bits(V a) { return _mm512_castpd_si512(a); }
+    static inline V bits(__m512i a) { return _mm512_castsi512_pd(a); }
+};
+
+// Byte compares need AVX-512BW, so this uses two AVX2 halves.
+struct Bytes {
+    static constexpr std::size_t width = 64;
+
+    static inline std::uint64_t match(const char* p, char a, char b) {
+        return avx2::Bytes::match(p, a, b) | avx2::Bytes::match(p + 32, a, b) << 32;
+    }
+};
+
+#include "simdkernels.inl"
+
+namespace f32 {
+
+struct Pack {
+    typedef __m512 V;
+    typedef __mmask16 M;
+    static constexpr std::size_t width = 16;
+
+    static inline V load(const float* p) { return _mm512_loadu_ps(p); }
+    static inline void store(float* p, V v) { _mm512_storeu_ps(p, v); }
+    static inline V set1(float v) { return _mm512_set1_ps(v); }
+    static inline V add(V a, V b) { return _mm512_add_ps(a, b); }
+    static inline V sub(V a, V b) { return _mm512_sub_ps(a, b); }
+    static inline V mul(V a, V b) { return _mm512_mul_ps(a, b); }
+    static inline V div(V a, V b) { return _mm512_div_ps(a, b); }
+    static inline V fma(V a, V b, V c) { return _mm512_fmadd_ps(a, b, c); }
+    static inline V abs(V a) {
+        return _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_set1_epi32(0x80000000), _mm512_castps_si512(a)));
+    }
+    static inline V round(V a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static inline M lt(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static inline M le(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static inline M eq(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static inline M either(M a, M b) { return a | b; }
+    static inline V select(M m, V a, V b) { return _mm512_mask_blend_ps(m, b, a); }
+    static inline bool all(M m) { return m == 0xffff; }
+};
+
+#include "simdfloatkernels.inl"
+
+} // namespace f32
+
+} // namespace avx512
+UNITIZED_SIMD_END
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+#endif // UNITIZED_SIMD_X86
+
+#define UNITIZED_SIMD_KERNELS(isa, ns) { \
+    isa, &ns::scale, \
+    &ns::sin, &ns::cos, &ns::tan, &ns::asin, &ns::acos, &ns::atan, &ns::atan2, \
+    &ns::sincos, \
+    &ns::nativeSin, &ns::nativeCos, &ns::nativeTan, &ns::nativeSincos, \
+    &ns::shotDeltas, &ns::deltaShots, \
+    &ns::sum, &ns::prefixSum, \
+    &ns::findSeparators \
+}
+
+#ifdef UNITIZED_SIMD_X86
+inline constexpr Kernels allKernels[] = {
+    UNITIZED_SIMD_KERNELS(Scalar, scalar),
+    UNITIZED_SIMD_KERNELS(SSE2, sse2),
+    UNITIZED_SIMD_KERNELS(AVX2, avx2),
+    UNITIZED_SIMD_KERNELS(AVX512, avx512)
+};
+#else
+inline constexpr Kernels allKernels[] = {
+    UNITIZED_SIMD_KERNELS(Scalar, scalar)
+};
+#endif
+
+#undef UNITIZED_SIMD_KERNELS
+
+#define UNITIZED_SIMD_FLOAT_KERNELS(isa, ns) { \
+    isa, &ns::f32::scale, &ns::f32::narrow, &ns::f32::widen, \
+    &ns::f32::sin, &ns::f32::cos, &ns::f32::tan, &ns::f32::sincos, \
+    &ns::f32::nativeSin, &ns::f32::nativeCos, &ns::f32::nativeTan, &ns::f32::nativeSincos \
+}
+
+#ifdef UNITIZED_SIMD_X86
+inline constexpr FloatKernels allFloatKernels[] = {
+    UNITIZED_SIMD_FLOAT_KERNELS(Scalar, scalar),
+    UNITIZED_SIMD_FLOAT_KERNELS(SSE2, sse2),
+    UNITIZED_SIMD_FLOAT_KERNELS(AVX2, avx2),
+    UNITIZED_SIMD_FLOAT_KERNELS(AVX512, avx512)
+};
+#else
+inline constexpr FloatKernels allFloatKernels[] = {
+    UNITIZED_SIMD_FLOAT_KERNELS(Scalar, scalar)
+};
+#endif
+
+#undef UNITIZED_SIMD_FLOAT_KERNELS
+
+} // namespace detail
+
+UNITIZED_INLINE Isa detectIsa() noexcept {
+#if defined(UNITIZED_SIMD_X86) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return AVX2;
+    if (__builtin_cpu_supports("sse2")) return SSE2;
+#elif defined(UNITIZED_SIMD_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    if (maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        bool avx512f = (info[1] & (1 << 16)) != 0;
+        if (avx512f && (xcr0 & 0xe6) == 0xe6) return AVX512;
+        if (avx2 && fma && (xcr0 & 0x6) == 0x6) return AVX2;
+    }
+    if (sse2) return SSE2;
+#endif
+    return Scalar;
+}
+
+UNITIZED_INLINE bool isSupported(Isa isa) noexcept {
+    return isa <= detectIsa();
+}
+
+UNITIZED_INLINE const Kernels& kernels(Isa isa) noexcept {
+    return detail::allKernels[isa];
+}
+
+UNITIZED_INLINE const Kernels& kernels() noexcept {
+    static const Kernels& active = kernels(detectIsa());
+    return active;
+}
+
+UNITIZED_INLINE const FloatKernels& floatKernels(Isa isa) noexcept {
+    return detail::allFloatKernels[isa];
+}
+
+UNITIZED_INLINE const FloatKernels& floatKernels() noexcept {
+    static const FloatKernels& active = floatKernels(detectIsa());
+    return active;
+}
+
+UNITIZED_INLINE void sincos(double radians, double& sin, double& cos) noexcept {
+    detail::scalar::sincos(&radians, &sin, &cos, 1);
+}
+
+// 0 - x rather than -x so exact zeros, like cos(90 degrees), stay positive.
+UNITIZED_INLINE double nativeSin(double value, double quarterTurn) noexcept {
+    int quadrant;
+    double r = detail::reduceNative(value, quarterTurn, quadrant);
+    switch (quadrant) {
+    case 0: return std::sin(r);
+    case 1: return std::cos(r);
+    case 2: return 0 - std::sin(r);
+    default: return 0 - std::cos(r);
+    }
+}
+UNITIZED_INLINE double nativeCos(double value, double quarterTurn) noexcept {
+    int quadrant;
+    double r = detail::reduceNative(value, quarterTurn, quadrant);
+    switch (quadrant) {
+    case 0: return std::cos(r);
+    case 1: return 0 - std::sin(r);
+    case 2: return 0 - std::cos(r);
+    default: return std::sin(r);
+    }
+}
+UNITIZED_INLINE double nativeTan(double value, double quarterTurn) noexcept {
+    int quadrant;
+    double r = detail::reduceNative(value, quarterTurn, quadrant);
+    return quadrant & 1 ? 1 / (0 - std::tan(r)) : std::tan(r);
+}
+UNITIZED_INLINE void nativeSincos(double value, double quarterTurn, double& sin, double& cos) noexcept {
+    int quadrant;
+    double r = detail::reduceNative(value, quarterTurn, quadrant);
+    double s = std::sin(r);
+    double c = std::cos(r);
+    switch (quadrant) {
+    case 0: sin = s; cos = c; break;
+    case 1: sin = c; cos = 0 - s; break;
+    case 2: sin = 0 - s; cos = 0 - c; break;
+    default: sin = 0 - c; cos = s; break;
+    }
+}
+
+} // namespace simd
+} // namespace unitized
+
+#undef UNITIZED_SIMD_BEGIN
+#undef UNITIZED_SIMD_END
+#undef UNITIZED_SIMD_STRINGIFY
@@ -0,0 +1,235 @@
+// Single-precision batch kernels, written once against a float Pack and
+// compiled for every instruction set by simd.inl, like simdkernels.inl.  A
+// pack holds twice as many floats as doubles.  No include guard, on purpose.
+
+// factor is split into two floats, so the product is within an ulp and
+// exact conversions like 90 degrees to 1600 mils stay exact.
+inline void scale(const float* in, float* out, std::size_t n, double factor) {
+    float high = static_cast<float>(factor);
+    float low = static_cast<float>(factor - high);
+    Pack::V h = Pack::set1(high);
+    Pack::V l = Pack::set1(low);
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x = Pack::load(in + i);
+        Pack::store(out + i, Pack::fma(x, h, Pack::mul(x, l)));
+    }
+    for (; i < n; i++) {
+        out[i] = in[i] * high + in[i] * low;
+    }
+}
+
+// The product is rounded once, to float.  Branch-free so it vectorizes.
+inline std::size_t narrow(const double* in, float* out, std::size_t n, double factor) {
+    std::size_t lost = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        double x = in[i] * factor;
+        float y = static_cast<float>(x);
+        out[i] = y;
+        double ax = std::fabs(x);
+        float ay = std::fabs(y);
+        lost += (ax < HUGE_VAL) & (ay == HUGE_VALF);
+        lost += (ax > 0) & (ay == 0);
+    }
+    return lost;
+}
+
+inline void widen(const float* in, double* out, std::size_t n, double factor) {
+    for (std::size_t i = 0; i < n; i++) {
+        out[i] = in[i] * factor;
+    }
+}
+
+template <class Op>
+inline void map(const Op& op, const float* in, float* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x = Pack::load(in + i);
+        Pack::store(out + i, op.apply(x));
+        if (!Pack::all(op.accurate(x))) {
+            float saved[Pack::width];
+            Pack::store(saved, x);
+            for (std::size_t j = 0; j < Pack::width; j++) out[i + j] = op.fallback(saved[j]);
+        }
+    }
+    if (i < n) {
+        float x[Pack::width], y[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) x[j] = i + j < n ? in[i + j] : 1;
+        map(op, x, y, Pack::width);
+        for (std::size_t j = i; j < n; j++) out[j] = y[j - i];
+    }
+}
+
+// sin and cos of r in [-pi/4, pi/4] (Cephes sinf and cosf), rotated into the
+// quadrant n, an integer.
+inline void sincosQuadrant(Pack::V r, Pack::V n, Pack::V& s, Pack::V& c) {
+    Pack::V z = Pack::mul(r, r);
+    Pack::V sp = Pack::set1(-1.9515295891e-4f);
+    sp = Pack::fma(sp, z, Pack::set1(8.3321608736e-3f));
+    sp = Pack::fma(sp, z, Pack::set1(-1.6666654611e-1f));
+    Pack::V sinR = Pack::fma(Pack::mul(r, z), sp, r);
+    Pack::V cp = Pack::set1(2.443315711809948e-5f);
+    cp = Pack::fma(cp, z, Pack::set1(-1.388731625493765e-3f));
+    cp = Pack::fma(cp, z, Pack::set1(4.166664568298827e-2f));
+    Pack::V cosR = Pack::fma(Pack::mul(z, z), cp, Pack::fma(z, Pack::set1(-0.5f), Pack::set1(1)));
+
+    Pack::V q = Pack::sub(n, Pack::mul(Pack::set1(4), Pack::round(Pack::mul(n, Pack::set1(0.25f)))));
+    Pack::M odd = Pack::eq(Pack::abs(q), Pack::set1(1));
+    Pack::V sinQ = Pack::select(odd, cosR, sinR);
+    Pack::V cosQ = Pack::select(odd, sinR, cosR);
+    Pack::M sinNegative = Pack::either(Pack::lt(q, Pack::set1(0)), Pack::lt(Pack::set1(1.5f), q));
+    Pack::M cosNegative = Pack::either(Pack::lt(Pack::set1(0.5f), q), Pack::lt(q, Pack::set1(-1.5f)));
+    s = Pack::select(sinNegative, Pack::sub(Pack::set1(0), sinQ), sinQ);
+    c = Pack::select(cosNegative, Pack::sub(Pack::set1(0), cosQ), cosQ);
+}
+
+// Cody-Waite reduction of radians by pi/2.  Lanes beyond TrigLimitF, and the
+// fallbacks generally, are computed in double and rounded.
+struct RadianReduction {
+    inline void reduce(Pack::V x, Pack::V& r, Pack::V& n) const {
+        n = Pack::round(Pack::mul(x, Pack::set1(TwoOverPiF)));
+        r = Pack::fma(n, Pack::set1(-PiOver2AF), x);
+        r = Pack::fma(n, Pack::set1(-PiOver2BF), r);
+        r = Pack::fma(n, Pack::set1(-PiOver2CF), r);
+        r = Pack::fma(n, Pack::set1(-PiOver2DF), r);
+    }
+    inline Pack::M accurate(Pack::V x) const {
+        return Pack::le(Pack::abs(x), Pack::set1(TrigLimitF));
+    }
+    inline void fallback(float x, float& sin, float& cos) const {
+        sin = static_cast<float>(std::sin(static_cast<double>(x)));
+        cos = static_cast<float>(std::cos(static_cast<double>(x)));
+    }
+};
+
+// Exact reduction in a unit with quarterTurn units per right angle, as in
+// the double kernels, for the integral quarterTurns below NativeLimitF.
+struct NativeReduction {
+    explicit NativeReduction(float quarterTurn):
+        quarterTurn(quarterTurn), inverse(1 / quarterTurn), toRadians(static_cast<float>(PiOver2 / quarterTurn)) {}
+
+    inline void reduce(Pack::V x, Pack::V& r, Pack::V& n) const {
+        n = Pack::round(Pack::mul(x, Pack::set1(inverse)));
+        r = Pack::mul(Pack::fma(n, Pack::set1(-quarterTurn), x), Pack::set1(toRadians));
+    }
+    inline Pack::M accurate(Pack::V x) const {
+        return Pack::le(Pack::abs(x), Pack::set1(NativeLimitF));
+    }
+    inline void fallback(float x, float& sin, float& cos) const {
+        double s, c;
+        simd::nativeSincos(x, quarterTurn, s, c);
+        sin = static_cast<float>(s);
+        cos = static_cast<float>(c);
+    }
+
+    float quarterTurn;
+    float inverse;
+    float toRadians;
+};
+
+template <class Reduction>
+inline void sincosWith(const Reduction& reduction, Pack::V x, Pack::V& s, Pack::V& c) {
+    Pack::V r, n;
+    reduction.reduce(x, r, n);
+    sincosQuadrant(r, n, s, c);
+}
+
+template <class Reduction>
+struct SinOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return s;
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline float fallback(float x) const {
+        float s, c;
+        reduction.fallback(x, s, c);
+        return s;
+    }
+};
+
+template <class Reduction>
+struct CosOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return c;
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline float fallback(float x) const {
+        float s, c;
+        reduction.fallback(x, s, c);
+        return c;
+    }
+};
+
+template <class Reduction>
+struct TanOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return Pack::div(s, c);
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline float fallback(float x) const {
+        float s, c;
+        reduction.fallback(x, s, c);
+        return s / c;
+    }
+};
+
+template <class Reduction>
+inline void sincosWith(const Reduction& reduction, const float* in, float* sin, float* cos, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x = Pack::load(in + i);
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        Pack::store(sin + i, s);
+        Pack::store(cos + i, c);
+        if (!Pack::all(reduction.accurate(x))) {
+            float saved[Pack::width];
+            Pack::store(saved, x);
+            for (std::size_t j = 0; j < Pack::width; j++) reduction.fallback(saved[j], sin[i + j], cos[i + j]);
+        }
+    }
+    if (i < n) {
+        float x[Pack::width], s[Pack::width], c[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) x[j] = i + j < n ? in[i + j] : 1;
+        sincosWith(reduction, x, s, c, Pack::width);
+        for (std::size_t j = i; j < n; j++) {
+            sin[j] = s[j - i];
+            cos[j] = c[j - i];
+        }
+    }
+}
+
+inline void sin(const float* in, float* out, std::size_t n) {
+    map(SinOp<RadianReduction>(), in, out, n);
+}
+inline void cos(const float* in, float* out, std::size_t n) {
+    map(CosOp<RadianReduction>(), in, out, n);
+}
+inline void tan(const float* in, float* out, std::size_t n) {
+    map(TanOp<RadianReduction>(), in, out, n);
+}
+inline void sincos(const float* in, float* sin, float* cos, std::size_t n) {
+    sincosWith(RadianReduction(), in, sin, cos, n);
+}
+
+inline void nativeSin(const float* in, float* out, std::size_t n, float quarterTurn) {
+    map(SinOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeCos(const float* in, float* out, std::size_t n, float quarterTurn) {
+    map(CosOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeTan(const float* in, float* out, std::size_t n, float quarterTurn) {
+    map(TanOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeSincos(const float* in, float* sin, float* cos, std::size_t n, float quarterTurn) {
+    sincosWith(NativeReduction(quarterTurn), in, sin, cos, n);
+}
@@ -0,0 +1,548 @@
+// Batch kernels, written once against the Pack interface and compiled for
+// every instruction set by simd.inl.  No include guard, on purpose.
+
+inline void scale(const double* in, double* out, std::size_t n, double factor) {
+    Pack::V f = Pack::set1(factor);
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::store(out + i, Pack::mul(Pack::load(in + i), f));
+    }
+    for (; i < n; i++) {
+        out[i] = in[i] * factor;
+    }
+}
+
+// Applies op to every element.  The tail goes through a pack padded with ones
+// so every element sees the same arithmetic.  If op.accurate() rejects any
+// lane of a pack, the whole pack is recomputed with op.fallback().
+template <class Op>
+inline void map(const Op& op, const double* in, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x = Pack::load(in + i);
+        Pack::store(out + i, op.apply(x));
+        if (!Pack::all(op.accurate(x))) {
+            // in may be out, so use the loaded copy
+            double saved[Pack::width];
+            Pack::store(saved, x);
+            for (std::size_t j = 0; j < Pack::width; j++) out[i + j] = op.fallback(saved[j]);
+        }
+    }
+    if (i < n) {
+        double x[Pack::width], y[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) x[j] = i + j < n ? in[i + j] : 1;
+        map(op, x, y, Pack::width);
+        for (std::size_t j = i; j < n; j++) out[j] = y[j - i];
+    }
+}
+
+template <class Op>
+inline void map(const Op& op, const double* in1, const double* in2, double* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x1 = Pack::load(in1 + i);
+        Pack::V x2 = Pack::load(in2 + i);
+        Pack::store(out + i, op.apply(x1, x2));
+        if (!Pack::all(op.accurate(x1, x2))) {
+            double saved1[Pack::width], saved2[Pack::width];
+            Pack::store(saved1, x1);
+            Pack::store(saved2, x2);
+            for (std::size_t j = 0; j < Pack::width; j++) out[i + j] = op.fallback(saved1[j], saved2[j]);
+        }
+    }
+    if (i < n) {
+        double x1[Pack::width], x2[Pack::width], y[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) {
+            x1[j] = i + j < n ? in1[i + j] : 1;
+            x2[j] = i + j < n ? in2[i + j] : 1;
+        }
+        map(op, x1, x2, y, Pack::width);
+        for (std::size_t j = i; j < n; j++) out[j] = y[j - i];
+    }
+}
+
+// sin and cos of r in [-pi/4, pi/4] (Cephes minimax polynomials), rotated into
+// the quadrant n, an integer.
+inline void sincosQuadrant(Pack::V r, Pack::V n, Pack::V& s, Pack::V& c) {
+    Pack::V z = Pack::mul(r, r);
+    Pack::V sp = Pack::set1(1.58962301576546568060e-10);
+    sp = Pack::fma(sp, z, Pack::set1(-2.50507477628578072866e-8));
+    sp = Pack::fma(sp, z, Pack::set1(2.75573136213857245213e-6));
+    sp = Pack::fma(sp, z, Pack::set1(-1.98412698295895385996e-4));
+    sp = Pack::fma(sp, z, Pack::set1(8.33333333332211858878e-3));
+    sp = Pack::fma(sp, z, Pack::set1(-1.66666666666666307295e-1));
+    Pack::V sinR = Pack::fma(Pack::mul(r, z), sp, r);
+    Pack::V cp = Pack::set1(-1.13585365213876817300e-11);
+    cp = Pack::fma(cp, z, Pack::set1(2.08757008419747316778e-9));
+    cp = Pack::fma(cp, z, Pack::set1(-2.75573141792967388112e-7));
+    cp = Pack::fma(cp, z, Pack::set1(2.48015872888517045348e-5));
+    cp = Pack::fma(cp, z, Pack::set1(-1.38888888888730564116e-3));
+    cp = Pack::fma(cp, z, Pack::set1(4.16666666666665929218e-2));
+    Pack::V cosR = Pack::fma(Pack::mul(z, z), cp, Pack::fma(z, Pack::set1(-0.5), Pack::set1(1)));
+
+    // q = n mod 4, as one of -2, -1, 0, 1, 2
+    Pack::V q = Pack::sub(n, Pack::mul(Pack::set1(4), Pack::round(Pack::mul(n, Pack::set1(0.25)))));
+    Pack::M odd = Pack::eq(Pack::abs(q), Pack::set1(1));
+    Pack::V sinQ = Pack::select(odd, cosR, sinR);
+    Pack::V cosQ = Pack::select(odd, sinR, cosR);
+    Pack::M sinNegative = Pack::either(Pack::lt(q, Pack::set1(0)), Pack::lt(Pack::set1(1.5), q));
+    Pack::M cosNegative = Pack::either(Pack::lt(Pack::set1(0.5), q), Pack::lt(q, Pack::set1(-1.5)));
+    // 0 - x rather than -x so exact zeros, like cos(90 degrees), stay positive
+    s = Pack::select(sinNegative, Pack::sub(Pack::set1(0), sinQ), sinQ);
+    c = Pack::select(cosNegative, Pack::sub(Pack::set1(0), cosQ), cosQ);
+}
+
+// Range reductions turn x into r in about [-pi/4, pi/4] radians plus the
+// quadrant n, an integer.  Lanes they can't reduce accurately go to fallback.
+
+// Cody-Waite reduction of radians by pi/2.
+struct RadianReduction {
+    inline void reduce(Pack::V x, Pack::V& r, Pack::V& n) const {
+        n = Pack::round(Pack::mul(x, Pack::set1(TwoOverPi)));
+        r = Pack::fma(n, Pack::set1(-PiOver2A), x);
+        r = Pack::fma(n, Pack::set1(-PiOver2B), r);
+        r = Pack::fma(n, Pack::set1(-PiOver2C), r);
+    }
+    inline Pack::M accurate(Pack::V x) const {
+        return Pack::le(Pack::abs(x), Pack::set1(TrigLimit));
+    }
+    inline void fallback(double x, double& sin, double& cos) const {
+        sin = std::sin(x);
+        cos = std::cos(x);
+    }
+};
+
+// Exact reduction in a unit with quarterTurn units per right angle: below
+// NativeLimit, n * quarterTurn and x - n * quarterTurn are both exact.
+struct NativeReduction {
+    explicit NativeReduction(double quarterTurn):
+        quarterTurn(quarterTurn), inverse(1 / quarterTurn), toRadians(PiOver2 / quarterTurn) {}
+
+    inline void reduce(Pack::V x, Pack::V& r, Pack::V& n) const {
+        n = Pack::round(Pack::mul(x, Pack::set1(inverse)));
+        r = Pack::mul(Pack::fma(n, Pack::set1(-quarterTurn), x), Pack::set1(toRadians));
+    }
+    inline Pack::M accurate(Pack::V x) const {
+        return Pack::le(Pack::abs(x), Pack::set1(NativeLimit));
+    }
+    inline void fallback(double x, double& sin, double& cos) const {
+        simd::nativeSincos(x, quarterTurn, sin, cos);
+    }
+
+    double quarterTurn;
+    double inverse;
+    double toRadians;
+};
+
+template <class Reduction>
+inline void sincosWith(const Reduction& reduction, Pack::V x, Pack::V& s, Pack::V& c) {
+    Pack::V r, n;
+    reduction.reduce(x, r, n);
+    sincosQuadrant(r, n, s, c);
+}
+
+template <class Reduction>
+struct SinOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return s;
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline double fallback(double x) const {
+        double s, c;
+        reduction.fallback(x, s, c);
+        return s;
+    }
+};
+
+template <class Reduction>
+struct CosOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return c;
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline double fallback(double x) const {
+        double s, c;
+        reduction.fallback(x, s, c);
+        return c;
+    }
+};
+
+template <class Reduction>
+struct TanOp {
+    Reduction reduction;
+    inline Pack::V apply(Pack::V x) const {
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        return Pack::div(s, c);
+    }
+    inline Pack::M accurate(Pack::V x) const { return reduction.accurate(x); }
+    inline double fallback(double x) const {
+        double s, c;
+        reduction.fallback(x, s, c);
+        return s / c;
+    }
+};
+
+template <class Reduction>
+inline void sincosWith(const Reduction& reduction, const double* in, double* sin, double* cos, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V x = Pack::load(in + i);
+        Pack::V s, c;
+        sincosWith(reduction, x, s, c);
+        Pack::store(sin + i, s);
+        Pack::store(cos + i, c);
+        if (!Pack::all(reduction.accurate(x))) {
+            // in may alias sin or cos, so use the loaded copy
+            double saved[Pack::width];
+            Pack::store(saved, x);
+            for (std::size_t j = 0; j < Pack::width; j++) reduction.fallback(saved[j], sin[i + j], cos[i + j]);
+        }
+    }
+    if (i < n) {
+        double x[Pack::width], s[Pack::width], c[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) x[j] = i + j < n ? in[i + j] : 1;
+        sincosWith(reduction, x, s, c, Pack::width);
+        for (std::size_t j = i; j < n; j++) {
+            sin[j] = s[j - i];
+            cos[j] = c[j - i];
+        }
+    }
+}
+
+// atan of x in [0, 1] (Cephes), reduced around tan(pi/8) and tan(3pi/8).
+inline Pack::V atanUnit(Pack::V x) {
+    Pack::M large = Pack::lt(Pack::set1(0.66), x);
+    Pack::V t = Pack::select(large, Pack::div(Pack::sub(x, Pack::set1(1)), Pack::add(x, Pack::set1(1))), x);
+    Pack::V z = Pack::mul(t, t);
+    Pack::V p = Pack::set1(-8.750608600031904122785e-1);
+    p = Pack::fma(p, z, Pack::set1(-1.615753718733365076637e1));
+    p = Pack::fma(p, z, Pack::set1(-7.500855792314704667340e1));
+    p = Pack::fma(p, z, Pack::set1(-1.228866684490136173410e2));
+    p = Pack::fma(p, z, Pack::set1(-6.485021904942025371773e1));
+    Pack::V q = Pack::add(z, Pack::set1(2.485846490142306297962e1));
+    q = Pack::fma(q, z, Pack::set1(1.650270098316988542046e2));
+    q = Pack::fma(q, z, Pack::set1(4.328810604912902668951e2));
+    q = Pack::fma(q, z, Pack::set1(4.853903996359136964868e2));
+    q = Pack::fma(q, z, Pack::set1(1.945506571482613964425e2));
+    Pack::V y = Pack::fma(Pack::mul(t, z), Pack::div(p, q), t);
+    Pack::V offset = Pack::select(large, Pack::set1(PiOver4), Pack::set1(0));
+    Pack::V offsetLow = Pack::select(large, Pack::set1(0.5 * PiOver2Low), Pack::set1(0));
+    return Pack::add(offset, Pack::add(y, offsetLow));
+}
+
+// atan2 for finite inputs not both zero; other lanes are up to the caller.
+inline Pack::V atan2Finite(Pack::V y, Pack::V x) {
+    Pack::V ax = Pack::abs(x);
+    Pack::V ay = Pack::abs(y);
+    Pack::V a = atanUnit(Pack::div(Pack::min(ax, ay), Pack::max(ax, ay)));
+    a = Pack::select(Pack::lt(ax, ay), Pack::add(Pack::sub(Pack::set1(PiOver2), a), Pack::set1(PiOver2Low)), a);
+    a = Pack::select(Pack::lt(x, Pack::set1(0)), Pack::add(Pack::sub(Pack::set1(Pi), a), Pack::set1(2 * PiOver2Low)), a);
+    return Pack::copysign(a, y);
+}
+
+inline Pack::M atan2Accurate(Pack::V y, Pack::V x) {
+    Pack::V m = Pack::max(Pack::abs(x), Pack::abs(y));
+    return Pack::both(Pack::lt(Pack::set1(0), m), Pack::lt(m, Pack::set1(HUGE_VAL)));
+}
+
+struct AsinOp {
+    static inline Pack::V cosine(Pack::V x) {
+        return Pack::sqrt(Pack::mul(Pack::sub(Pack::set1(1), x), Pack::add(Pack::set1(1), x)));
+    }
+    static inline Pack::V apply(Pack::V x) { return atan2Finite(x, cosine(x)); }
+    static inline Pack::M accurate(Pack::V x) { return Pack::le(Pack::abs(x), Pack::set1(1)); }
+    static inline double fallback(double x) { return std::asin(x); }
+};
+
+struct AcosOp {
+    static inline Pack::V apply(Pack::V x) { return atan2Finite(AsinOp::cosine(x), x); }
+    static inline Pack::M accurate(Pack::V x) { return AsinOp::accurate(x); }
+    static inline double fallback(double x) { return std::acos(x); }
+};
+
+struct AtanOp {
+    static inline Pack::V apply(Pack::V x) {
+        Pack::V ax = Pack::abs(x);
+        Pack::M large = Pack::lt(Pack::set1(1), ax);
+        Pack::V a = atanUnit(Pack::select(large, Pack::div(Pack::set1(1), ax), ax));
+        a = Pack::select(large, Pack::add(Pack::sub(Pack::set1(PiOver2), a), Pack::set1(PiOver2Low)), a);
+        return Pack::copysign(a, x);
+    }
+    // NaN propagates and infinities give 1/x = 0
+    static inline Pack::M accurate(Pack::V) { return Pack::eq(Pack::set1(0), Pack::set1(0)); }
+    static inline double fallback(double x) { return std::atan(x); }
+};
+
+struct Atan2Op {
+    static inline Pack::V apply(Pack::V y, Pack::V x) { return atan2Finite(y, x); }
+    static inline Pack::M accurate(Pack::V y, Pack::V x) { return atan2Accurate(y, x); }
+    static inline double fallback(double y, double x) { return std::atan2(y, x); }
+};
+
+inline void sin(const double* in, double* out, std::size_t n) {
+    map(SinOp<RadianReduction>(), in, out, n);
+}
+inline void cos(const double* in, double* out, std::size_t n) {
+    map(CosOp<RadianReduction>(), in, out, n);
+}
+inline void tan(const double* in, double* out, std::size_t n) {
+    map(TanOp<RadianReduction>(), in, out, n);
+}
+inline void asin(const double* in, double* out, std::size_t n) {
+    map(AsinOp(), in, out, n);
+}
+inline void acos(const double* in, double* out, std::size_t n) {
+    map(AcosOp(), in, out, n);
+}
+inline void atan(const double* in, double* out, std::size_t n) {
+    map(AtanOp(), in, out, n);
+}
+inline void atan2(const double* y, const double* x, double* out, std::size_t n) {
+    map(Atan2Op(), y, x, out, n);
+}
+inline void sincos(const double* in, double* sin, double* cos, std::size_t n) {
+    sincosWith(RadianReduction(), in, sin, cos, n);
+}
+
+inline void nativeSin(const double* in, double* out, std::size_t n, double quarterTurn) {
+    map(SinOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeCos(const double* in, double* out, std::size_t n, double quarterTurn) {
+    map(CosOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeTan(const double* in, double* out, std::size_t n, double quarterTurn) {
+    map(TanOp<NativeReduction>{NativeReduction(quarterTurn)}, in, out, n);
+}
+inline void nativeSincos(const double* in, double* sin, double* cos, std::size_t n, double quarterTurn) {
+    sincosWith(NativeReduction(quarterTurn), in, sin, cos, n);
+}
+
+// Survey shots to east, north and up deltas in one pass: the distance is
+// scaled into the output unit and both angles share the pack with it.  If
+// either reduction rejects a lane, the whole pack is redone with fallbacks.
+template <class AzimuthReduction, class InclinationReduction>
+inline void shotDeltasWith(const AzimuthReduction& azimuthReduction, const InclinationReduction& inclinationReduction,
+                           const double* distance, const double* azimuth, const double* inclination,
+                           double* east, double* north, double* up, std::size_t n, double distanceFactor) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V d = Pack::mul(Pack::load(distance + i), Pack::set1(distanceFactor));
+        Pack::V a = Pack::load(azimuth + i);
+        Pack::V b = Pack::load(inclination + i);
+        Pack::V sinA, cosA, sinB, cosB;
+        sincosWith(azimuthReduction, a, sinA, cosA);
+        sincosWith(inclinationReduction, b, sinB, cosB);
+        Pack::V horizontal = Pack::mul(d, cosB);
+        Pack::store(east + i, Pack::mul(horizontal, sinA));
+        Pack::store(north + i, Pack::mul(horizontal, cosA));
+        Pack::store(up + i, Pack::mul(d, sinB));
+        if (!Pack::all(Pack::both(azimuthReduction.accurate(a), inclinationReduction.accurate(b)))) {
+            // the outputs may alias the inputs, so use the loaded copies
+            double savedD[Pack::width], savedA[Pack::width], savedB[Pack::width];
+            Pack::store(savedD, d);
+            Pack::store(savedA, a);
+            Pack::store(savedB, b);
+            for (std::size_t j = 0; j < Pack::width; j++) {
+                double sinAj, cosAj, sinBj, cosBj;
+                azimuthReduction.fallback(savedA[j], sinAj, cosAj);
+                inclinationReduction.fallback(savedB[j], sinBj, cosBj);
+                east[i + j] = savedD[j] * cosBj * sinAj;
+                north[i + j] = savedD[j] * cosBj * cosAj;
+                up[i + j] = savedD[j] * sinBj;
+            }
+        }
+    }
+    if (i < n) {
+        double d[Pack::width], a[Pack::width], b[Pack::width], e[Pack::width], no[Pack::width], u[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) {
+            d[j] = i + j < n ? distance[i + j] : 1;
+            a[j] = i + j < n ? azimuth[i + j] : 1;
+            b[j] = i + j < n ? inclination[i + j] : 1;
+        }
+        shotDeltasWith(azimuthReduction, inclinationReduction, d, a, b, e, no, u, Pack::width, distanceFactor);
+        for (std::size_t j = i; j < n; j++) {
+            east[j] = e[j - i];
+            north[j] = no[j - i];
+            up[j] = u[j - i];
+        }
+    }
+}
+
+inline void shotDeltas(const double* distance, const double* azimuth, const double* inclination,
+                       double* east, double* north, double* up, std::size_t n,
+                       double distanceFactor, double azimuthQuarterTurn, double inclinationQuarterTurn) {
+    if (azimuthQuarterTurn && inclinationQuarterTurn) {
+        shotDeltasWith(NativeReduction(azimuthQuarterTurn), NativeReduction(inclinationQuarterTurn),
+                       distance, azimuth, inclination, east, north, up, n, distanceFactor);
+    } else if (azimuthQuarterTurn) {
+        shotDeltasWith(NativeReduction(azimuthQuarterTurn), RadianReduction(),
+                       distance, azimuth, inclination, east, north, up, n, distanceFactor);
+    } else if (inclinationQuarterTurn) {
+        shotDeltasWith(RadianReduction(), NativeReduction(inclinationQuarterTurn),
+                       distance, azimuth, inclination, east, north, up, n, distanceFactor);
+    } else {
+        shotDeltasWith(RadianReduction(), RadianReduction(),
+                       distance, azimuth, inclination, east, north, up, n, distanceFactor);
+    }
+}
+
+// The inverse of shotDeltas for one lane, through libm's hypot and atan2.
+// Vertical shots get azimuth 0.
+inline void deltaShot(double east, double north, double up, double& distance, double& azimuth, double& inclination,
+                      double distanceFactor, double azimuthFactor, double inclinationFactor, double fullTurn) {
+    double horizontal = std::hypot(east, north);
+    distance = std::hypot(horizontal, up) * distanceFactor;
+    azimuth = horizontal == 0 ? 0 : std::atan2(east, north) * azimuthFactor;
+    azimuth += azimuth < 0 ? fullTurn : 0;
+    azimuth = azimuth >= fullTurn ? 0 : azimuth;
+    inclination = std::atan2(up, horizontal) * inclinationFactor;
+}
+
+// Deltas back to shots in one pass.  The sums of squares are only used while
+// they can't overflow or underflow; other packs go through deltaShot.
+inline void deltaShots(const double* east, const double* north, const double* up,
+                       double* distance, double* azimuth, double* inclination, std::size_t n,
+                       double distanceFactor, double azimuthFactor, double inclinationFactor, double fullTurn) {
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::V e = Pack::load(east + i);
+        Pack::V no = Pack::load(north + i);
+        Pack::V u = Pack::load(up + i);
+        Pack::V horizontalSquared = Pack::fma(e, e, Pack::mul(no, no));
+        Pack::V horizontal = Pack::sqrt(horizontalSquared);
+        Pack::store(distance + i, Pack::mul(Pack::sqrt(Pack::fma(u, u, horizontalSquared)), Pack::set1(distanceFactor)));
+        Pack::V a = Pack::mul(atan2Finite(e, no), Pack::set1(azimuthFactor));
+        // vertical shots point nowhere in particular, so call it north
+        a = Pack::select(Pack::eq(horizontal, Pack::set1(0)), Pack::set1(0), a);
+        // + 0 turns -0 into 0, and rounding up to a full turn wraps to 0
+        a = Pack::add(a, Pack::select(Pack::lt(a, Pack::set1(0)), Pack::set1(fullTurn), Pack::set1(0)));
+        Pack::store(azimuth + i, Pack::select(Pack::le(Pack::set1(fullTurn), a), Pack::set1(0), a));
+        Pack::store(inclination + i, Pack::mul(atan2Finite(u, horizontal), Pack::set1(inclinationFactor)));
+
+        Pack::V m = Pack::max(Pack::max(Pack::abs(e), Pack::abs(no)), Pack::abs(u));
+        if (!Pack::all(Pack::both(Pack::le(Pack::set1(HypotMin), m), Pack::le(m, Pack::set1(HypotMax))))) {
+            // the outputs may alias the inputs, so use the loaded copies
+            double savedE[Pack::width], savedN[Pack::width], savedU[Pack::width];
+            Pack::store(savedE, e);
+            Pack::store(savedN, no);
+            Pack::store(savedU, u);
+            for (std::size_t j = 0; j < Pack::width; j++) {
+                deltaShot(savedE[j], savedN[j], savedU[j], distance[i + j], azimuth[i + j], inclination[i + j],
+                          distanceFactor, azimuthFactor, inclinationFactor, fullTurn);
+            }
+        }
+    }
+    if (i < n) {
+        double e[Pack::width], no[Pack::width], u[Pack::width], d[Pack::width], a[Pack::width], b[Pack::width];
+        for (std::size_t j = 0; j < Pack::width; j++) {
+            e[j] = i + j < n ? east[i + j] : 1;
+            no[j] = i + j < n ? north[i + j] : 1;
+            u[j] = i + j < n ? up[i + j] : 1;
+        }
+        deltaShots(e, no, u, d, a, b, Pack::width, distanceFactor, azimuthFactor, inclinationFactor, fullTurn);
+        for (std::size_t j = i; j < n; j++) {
+            distance[j] = d[j - i];
+            azimuth[j] = a[j - i];
+            inclination[j] = b[j - i];
+        }
+    }
+}
+
+// Neumaier's compensated addition in every lane.
+inline void addCompensated(Pack::V& sum, Pack::V& compensation, Pack::V x) {
+    Pack::V t = Pack::add(sum, x);
+    Pack::M sumLarger = Pack::le(Pack::abs(x), Pack::abs(sum));
+    Pack::V lost = Pack::select(sumLarger, Pack::add(Pack::sub(sum, t), x), Pack::add(Pack::sub(x, t), sum));
+    compensation = Pack::add(compensation, lost);
+    sum = t;
+}
+
+// Two packs of accumulators hide the latency of the dependent adds.
+inline void sum(const double* in, std::size_t n, double& sum, double& compensation) {
+    Pack::V sum0 = Pack::set1(0), sum1 = Pack::set1(0);
+    Pack::V compensation0 = Pack::set1(0), compensation1 = Pack::set1(0);
+    std::size_t i = 0;
+    for (; i + 2 * Pack::width <= n; i += 2 * Pack::width) {
+        addCompensated(sum0, compensation0, Pack::load(in + i));
+        addCompensated(sum1, compensation1, Pack::load(in + i + Pack::width));
+    }
+    double sums[2 * Pack::width], compensations[2 * Pack::width];
+    Pack::store(sums, sum0);
+    Pack::store(sums + Pack::width, sum1);
+    Pack::store(compensations, compensation0);
+    Pack::store(compensations + Pack::width, compensation1);
+    for (std::size_t j = 0; j < 2 * Pack::width; j++) {
+        detail::addCompensated(sum, compensation, sums[j]);
+        compensation += compensations[j];
+    }
+    for (; i < n; i++) {
+        detail::addCompensated(sum, compensation, in[i]);
+    }
+}
+
+// The inclusive prefix sums of a pack, as s + e with e from addCompensated:
+// each step adds the pack moved up by twice as many lanes as the last.
+template <std::size_t lanes = 1>
+inline void scanPack(Pack::V& s, Pack::V& e) {
+    if constexpr (lanes < Pack::width) {
+        Pack::V shifted = Pack::shiftUp<lanes>(e);
+        addCompensated(s, e, Pack::shiftUp<lanes>(s));
+        e = Pack::add(e, shifted);
+        scanPack<2 * lanes>(s, e);
+    }
+}
+
+// Each pack is scanned in registers and then offset by the total before it,
+// so only that last compensated add depends on the previous pack.  The tail
+// goes through a pack padded with zeros, which leave the total alone.
+inline void prefixSum(const double* in, double* out, std::size_t n, double& sum, double& compensation,
+                      double factor, double offset) {
+    Pack::V total = Pack::set1(sum), totalCompensation = Pack::set1(compensation);
+    Pack::V scale = Pack::set1(factor), shift = Pack::set1(offset);
+    auto scan = [&](Pack::V s) {
+        Pack::V e = Pack::set1(0);
+        scanPack(s, e);
+        addCompensated(s, e, total);
+        e = Pack::add(e, totalCompensation);
+        total = Pack::broadcastLast(s);
+        totalCompensation = Pack::broadcastLast(e);
+        return Pack::fma(Pack::add(s, e), scale, shift);
+    };
+    std::size_t i = 0;
+    for (; i + Pack::width <= n; i += Pack::width) {
+        Pack::store(out + i, scan(Pack::load(in + i)));
+    }
+    if (i < n) {
+        double buffer[Pack::width] = {};
+        for (std::size_t j = 0; i + j < n; j++) buffer[j] = in[i + j];
+        Pack::store(buffer, scan(Pack::load(buffer)));
+        for (std::size_t j = 0; i + j < n; j++) out[i + j] = buffer[j];
+    }
+    double totals[Pack::width];
+    Pack::store(totals, total);
+    sum = totals[0];
+    Pack::store(totals, totalCompensation);
+    compensation = totals[0];
+}
+
+// Bytes::width bytes per step; the set bits of each mask come out in order.
+inline std::size_t findSeparators(const char* text, std::size_t n, char delimiter, std::uint32_t* positions) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + Bytes::width <= n; i += Bytes::width) {
+        for (std::uint64_t mask = Bytes::match(text + i, delimiter, '\n'); mask; mask &= mask - 1) {
+            positions[count++] = static_cast<std::uint32_t>(i + countTrailingZeros(mask));
+        }
+    }
+    for (; i < n; i++) {
+        if (text[i] == delimiter || text[i] == '\n') positions[count++] = static_cast<std::uint32_t>(i);
+    }
+    return count;
+}
@@ -0,0 +1,5 @@
+#include "summation.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "summation.inl"
+#endif
@@ -0,0 +1,167 @@
+#ifndef UNITIZED_SUMMATION_H
+#define UNITIZED_SUMMATION_H
+
+#include "unitizedglobal.h"
+#include "length.h"
+#include "angle.h"
+#include "lengtharray.h"
+#include "anglearray.h"
+#include "simd.h"
+#include "threadpool.h"
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace unitized {
+
+namespace detail {
+
+template <class Quantity>
+struct SumTraits;
+
+template <>
+struct SumTraits<Length> {
+    static constexpr int UnitCount = Length::Miles + 1;
+    static constexpr Length::Unit DefaultUnit = Length::Meters;
+    static constexpr Length::Unit linearUnit(Length::Unit unit) { return unit; }
+};
+
+// Grades don't add, so PercentGrade angles are summed in radians.
+template <>
+struct SumTraits<Angle> {
+    static constexpr int UnitCount = Angle::PercentGrade + 1;
+    static constexpr Angle::Unit DefaultUnit = Angle::Degrees;
+    static constexpr Angle::Unit linearUnit(Angle::Unit unit) {
+        return unit == Angle::PercentGrade ? Angle::Radians : unit;
+    }
+};
+
+// Compensated totals kept separately for each unit, so values are summed
+// exactly as given and only each unit's total is converted.  Values are
+// buffered per unit and fed to the SIMD sum kernel a buffer at a time.
+template <class Quantity>
+class UnitSums
+{
+public:
+    typedef SumTraits<Quantity> Traits;
+    typedef typename Quantity::Unit Unit;
+
+    void add(Quantity quantity) {
+        Unit unit = Traits::linearUnit(quantity.unit);
+        buffers[unit][counts[unit]++] = quantity.convertTo(unit);
+        if (counts[unit] == BufferSize) flush(unit);
+        size++;
+    }
+
+    std::size_t count() const { return size; }
+
+    Quantity total(Unit unit) {
+        Unit linear = Traits::linearUnit(unit);
+        double terms[2 * Traits::UnitCount] = {};
+        for (int u = 1; u < Traits::UnitCount; u++) {
+            flush(static_cast<Unit>(u));
+            terms[2 * u] = Quantity(sums[u], static_cast<Unit>(u)).convertTo(linear);
+            terms[2 * u + 1] = Quantity(compensations[u], static_cast<Unit>(u)).convertTo(linear);
+        }
+        double sum = 0, compensation = 0;
+        simd::kernels().sum(terms, 2 * Traits::UnitCount, sum, compensation);
+        return Quantity(sum + compensation, linear).as(unit);
+    }
+
+private:
+    static constexpr std::size_t BufferSize = 256;
+
+    double buffers[Traits::UnitCount][BufferSize];
+    std::size_t counts[Traits::UnitCount] = {};
+    double sums[Traits::UnitCount] = {};
+    double compensations[Traits::UnitCount] = {};
+    std::size_t size = 0;
+
+    void flush(Unit unit) {
+        simd::kernels().sum(buffers[unit], counts[unit], sums[unit], compensations[unit]);
+        counts[unit] = 0;
+    }
+};
+
+// The compensated total of a column, in L2-sized chunks on policy's threads.
+// toLinear, if given, converts a chunk into a buffer that can be summed.
+template <class ToLinear>
+double columnSum(const double* values, std::size_t n, const ExecutionPolicy& policy, const ToLinear* toLinear) {
+    std::size_t chunkSize = policy.chunkSize(sizeof(double));
+    std::vector<double> sums((n + chunkSize - 1) / chunkSize), compensations(sums.size());
+    policy.forEachChunk(n, chunkSize, [&](std::size_t begin, std::size_t end) {
+        std::size_t c = begin / chunkSize;
+        if (!toLinear) {
+            simd::kernels().sum(values + begin, end - begin, sums[c], compensations[c]);
+            return;
+        }
+        const std::size_t blockSize = 512;
+        double buffer[blockSize];
+        for (std::size_t i = begin; i < end; i += blockSize) {
+            std::size_t count = std::min(blockSize, end - i);
+            toLinear->apply(values + i, buffer, count);
+            simd::kernels().sum(buffer, count, sums[c], compensations[c]);
+        }
+    });
+    double sum = 0, compensation = 0;
+    for (std::size_t c = 0; c < sums.size(); c++) {
+        double total[2] = {sums[c], compensations[c]};
+        simd::kernels().sum(total, 2, sum, compensation);
+    }
+    return sum + compensation;
+}
+
+template <class Range>
+using RangeQuantity = typename std::decay<decltype(*std::begin(std::declval<const Range&>()))>::type;
+
+} // namespace detail
+
+// Sums a range of Lengths or Angles, in any mix of units, with compensated
+// summation in several independent accumulators per unit.  The result is in
+// unit, or without one in the unit of the first element.
+template <class Range>
+detail::RangeQuantity<Range> sum(const Range& range, typename detail::RangeQuantity<Range>::Unit unit) {
+    detail::UnitSums<detail::RangeQuantity<Range>> sums;
+    for (const auto& quantity : range) sums.add(quantity);
+    return sums.total(unit);
+}
+template <class Range>
+detail::RangeQuantity<Range> sum(const Range& range) {
+    typedef detail::RangeQuantity<Range> Quantity;
+    auto first = std::begin(range);
+    return sum(range, first == std::end(range) ? detail::SumTraits<Quantity>::DefaultUnit : (*first).unit);
+}
+
+// The mean of a range, like sum; NaN if the range is empty.
+template <class Range>
+detail::RangeQuantity<Range> mean(const Range& range, typename detail::RangeQuantity<Range>::Unit unit) {
+    typedef detail::RangeQuantity<Range> Quantity;
+    detail::UnitSums<Quantity> sums;
+    for (const auto& quantity : range) sums.add(quantity);
+    typename Quantity::Unit linear = detail::SumTraits<Quantity>::linearUnit(unit);
+    if (!sums.count()) return Quantity(NAN, unit);
+    return sums.total(linear).div(static_cast<double>(sums.count())).as(unit);
+}
+template <class Range>
+detail::RangeQuantity<Range> mean(const Range& range) {
+    typedef detail::RangeQuantity<Range> Quantity;
+    auto first = std::begin(range);
+    return mean(range, first == std::end(range) ? detail::SumTraits<Quantity>::DefaultUnit : (*first).unit);
+}
+
+// Sums or averages a whole column through the SIMD sum kernel, optionally in
+// parallel.  The result is in the column's unit.
+UNITIZED_INLINE Length sum(const LengthArray& lengths, const ExecutionPolicy& policy = ExecutionPolicy());
+UNITIZED_INLINE Angle sum(const AngleArray& angles, const ExecutionPolicy& policy = ExecutionPolicy());
+UNITIZED_INLINE Length mean(const LengthArray& lengths, const ExecutionPolicy& policy = ExecutionPolicy());
+UNITIZED_INLINE Angle mean(const AngleArray& angles, const ExecutionPolicy& policy = ExecutionPolicy());
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "summation.inl"
+#endif
+
+#endif // UNITIZED_SUMMATION_H
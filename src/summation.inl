@@ -0,0 +1,26 @@
+namespace unitized {
+
+UNITIZED_INLINE Length sum(const LengthArray& lengths, const ExecutionPolicy& policy) {
+    return Length(detail::columnSum<Length::Converter>(lengths.data(), lengths.size(), policy, nullptr),
+                  lengths.unit());
+}
+UNITIZED_INLINE Angle sum(const AngleArray& angles, const ExecutionPolicy& policy) {
+    if (angles.unit() != Angle::PercentGrade) {
+        return Angle(detail::columnSum<Angle::Converter>(angles.data(), angles.size(), policy, nullptr),
+                     angles.unit());
+    }
+    Angle::Converter toRadians(Angle::PercentGrade, Angle::Radians);
+    return Angle::radians(detail::columnSum(angles.data(), angles.size(), policy, &toRadians))
+        .as(Angle::PercentGrade);
+}
+UNITIZED_INLINE Length mean(const LengthArray& lengths, const ExecutionPolicy& policy) {
+    return sum(lengths, policy).div(static_cast<double>(lengths.size()));
+}
+UNITIZED_INLINE Angle mean(const AngleArray& angles, const ExecutionPolicy& policy) {
+    if (angles.unit() != Angle::PercentGrade) {
+        return sum(angles, policy).div(static_cast<double>(angles.size()));
+    }
+    return sum(angles, policy).asRadians().div(static_cast<double>(angles.size())).as(Angle::PercentGrade);
+}
+
+} // namespace unitized
@@ -0,0 +1,5 @@
+#include "threadpool.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "threadpool.inl"
+#endif
@@ -0,0 +1,119 @@
+#ifndef UNITIZED_THREADPOOL_H
+#define UNITIZED_THREADPOOL_H
+
+#include "unitizedglobal.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace unitized {
+
+// A fixed set of worker threads that run chunks of batch operations.  Each
+// worker takes chunks from the front of its own queue and, when that runs
+// dry, steals from the back of the others'.  The threads live as long as the
+// pool, so batches pay no spawn cost.
+class ThreadPool
+{
+public:
+    // threads == 0 means one worker per hardware thread besides the caller's.
+    UNITIZED_INLINE explicit ThreadPool(unsigned threads = 0);
+    UNITIZED_INLINE ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The pool the batch APIs use by default, started on first use.
+    static UNITIZED_INLINE ThreadPool& shared();
+
+    UNITIZED_INLINE unsigned size() const noexcept;
+
+    // Runs body(begin, end) over [0, n) in chunks of at most chunkSize, on
+    // the workers and the calling thread, and returns once every chunk is
+    // done.  The first exception a chunk throws is rethrown here.
+    UNITIZED_INLINE void forEachChunk(std::size_t n, std::size_t chunkSize,
+                                      const std::function<void(std::size_t, std::size_t)>& body);
+
+    // The size of this CPU's L2 cache in bytes, or a typical 256 KiB.
+    static UNITIZED_INLINE std::size_t l2CacheSize() noexcept;
+
+private:
+    struct Job {
+        const std::function<void(std::size_t, std::size_t)>* body;
+        std::size_t remaining;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    struct Task {
+        Job* job;
+        std::size_t begin;
+        std::size_t end;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // set before the threads start, since they read it while the vector grows
+    unsigned workers;
+    std::vector<std::thread> threads;
+    std::unique_ptr<Queue[]> queues;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::size_t queued = 0;
+    bool stopping = false;
+
+    UNITIZED_INLINE void work(unsigned index);
+    UNITIZED_INLINE bool take(unsigned index, Task& task);
+    UNITIZED_INLINE bool steal(unsigned thief, Task& task);
+    static UNITIZED_INLINE void run(const Task& task);
+    static UNITIZED_INLINE bool finished(Job& job);
+};
+
+// Where a batch operation runs: on the calling thread (the default), or in
+// chunks across a ThreadPool.
+class ExecutionPolicy
+{
+public:
+    UNITIZED_CONSTEXPR ExecutionPolicy() noexcept;
+
+    static UNITIZED_CONSTEXPR ExecutionPolicy sequential() noexcept;
+    static UNITIZED_INLINE ExecutionPolicy parallel();
+    static UNITIZED_CONSTEXPR ExecutionPolicy parallel(ThreadPool& pool) noexcept;
+
+    UNITIZED_CONSTEXPR bool isParallel() const noexcept;
+    UNITIZED_CONSTEXPR ThreadPool* pool() const noexcept;
+
+    // Elements per chunk for an operation streaming bytesPerElement bytes
+    // per element, so a chunk fills half of L2.
+    UNITIZED_INLINE std::size_t chunkSize(std::size_t bytesPerElement) const noexcept;
+
+    // Runs body(begin, end) over [0, n) in chunks of chunkSize, or all at
+    // once when sequential.
+    template <class Body>
+    void forEachChunk(std::size_t n, std::size_t chunkSize, const Body& body) const {
+        if (!threadPool || n <= chunkSize) {
+            if (n) body(std::size_t(0), n);
+            return;
+        }
+        threadPool->forEachChunk(n, chunkSize, body);
+    }
+
+private:
+    ThreadPool* threadPool;
+
+    UNITIZED_CONSTEXPR explicit ExecutionPolicy(ThreadPool* pool) noexcept;
+};
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "threadpool.inl"
+#endif
+
+#endif // UNITIZED_THREADPOOL_H
@@ -0,0 +1,177 @@
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace unitized {
+
+UNITIZED_INLINE ThreadPool::ThreadPool(unsigned threads) {
+    if (!threads) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        threads = hardware > 1 ? hardware - 1 : 0;
+    }
+    workers = threads;
+    queues.reset(new Queue[threads]);
+    for (unsigned i = 0; i < threads; i++) {
+        this->threads.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+UNITIZED_INLINE ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) thread.join();
+}
+
+UNITIZED_INLINE ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+UNITIZED_INLINE unsigned ThreadPool::size() const noexcept {
+    return workers;
+}
+
+UNITIZED_INLINE void ThreadPool::forEachChunk(std::size_t n, std::size_t chunkSize,
+                                              const std::function<void(std::size_t, std::size_t)>& body) {
+    chunkSize = std::max<std::size_t>(chunkSize, 1);
+    std::size_t chunks = (n + chunkSize - 1) / chunkSize;
+    if (chunks <= 1 || !workers) {
+        if (n) body(0, n);
+        return;
+    }
+
+    Job job;
+    job.body = &body;
+    job.remaining = chunks;
+
+    // Each worker gets a contiguous run of chunks, so it streams through
+    // memory in order until it has to steal.
+    for (unsigned w = 0; w < workers; w++) {
+        std::size_t first = chunks * w / workers, last = chunks * (w + 1) / workers;
+        std::lock_guard<std::mutex> lock(queues[w].mutex);
+        for (std::size_t c = first; c < last; c++) {
+            queues[w].tasks.push_back(Task{&job, c * chunkSize, std::min(n, (c + 1) * chunkSize)});
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queued += chunks;
+    }
+    wake.notify_all();
+
+    // The caller steals too, instead of waiting idle.
+    Task task;
+    while (!finished(job)) {
+        if (steal(workers, task)) {
+            run(task);
+        } else {
+            std::unique_lock<std::mutex> lock(job.mutex);
+            job.done.wait(lock, [&] { return job.remaining == 0; });
+        }
+    }
+    if (job.error) std::rethrow_exception(job.error);
+}
+
+UNITIZED_INLINE std::size_t ThreadPool::l2CacheSize() noexcept {
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    static const long size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (size > 0) return static_cast<std::size_t>(size);
+#endif
+    return 256 * 1024;
+}
+
+UNITIZED_INLINE void ThreadPool::work(unsigned index) {
+    Task task;
+    for (;;) {
+        if (take(index, task) || steal(index, task)) {
+            run(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [&] { return stopping || queued > 0; });
+        if (stopping && !queued) return;
+    }
+}
+
+UNITIZED_INLINE bool ThreadPool::take(unsigned index, Task& task) {
+    {
+        std::lock_guard<std::mutex> lock(queues[index].mutex);
+        if (queues[index].tasks.empty()) return false;
+        task = queues[index].tasks.front();
+        queues[index].tasks.pop_front();
+    }
+    std::lock_guard<std::mutex> lock(sleepMutex);
+    queued--;
+    return true;
+}
+
+// Steals from the back of the other queues, starting after the thief's own
+// so thieves spread out.  The caller of forEachChunk steals as index size().
+UNITIZED_INLINE bool ThreadPool::steal(unsigned thief, Task& task) {
+    for (unsigned i = 1; i <= workers; i++) {
+        Queue& victim = queues[(thief + i) % workers];
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) continue;
+            task = victim.tasks.back();
+            victim.tasks.pop_back();
+        }
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+UNITIZED_INLINE void ThreadPool::run(const Task& task) {
+    Job& job = *task.job;
+    std::exception_ptr error;
+    try {
+        (*job.body)(task.begin, task.end);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // The job lives on its caller's stack, so it must not be touched after
+    // the last chunk lets the caller return.
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (error && !job.error) job.error = error;
+    if (--job.remaining == 0) job.done.notify_all();
+}
+
+UNITIZED_INLINE bool ThreadPool::finished(Job& job) {
+    std::lock_guard<std::mutex> lock(job.mutex);
+    return job.remaining == 0;
+}
+
+UNITIZED_CONSTEXPR ExecutionPolicy::ExecutionPolicy() noexcept: threadPool(nullptr) {}
+UNITIZED_CONSTEXPR ExecutionPolicy::ExecutionPolicy(ThreadPool* pool) noexcept: threadPool(pool) {}
+
+UNITIZED_CONSTEXPR ExecutionPolicy ExecutionPolicy::sequential() noexcept {
+    return ExecutionPolicy();
+}
+UNITIZED_INLINE ExecutionPolicy ExecutionPolicy::parallel() {
+    return ExecutionPolicy(&ThreadPool::shared());
+}
+UNITIZED_CONSTEXPR ExecutionPolicy ExecutionPolicy::parallel(ThreadPool& pool) noexcept {
+    return ExecutionPolicy(&pool);
+}
+
+UNITIZED_CONSTEXPR bool ExecutionPolicy::isParallel() const noexcept {
+    return threadPool != nullptr;
+}
+UNITIZED_CONSTEXPR ThreadPool* ExecutionPolicy::pool() const noexcept {
+    return threadPool;
+}
+
+UNITIZED_INLINE std::size_t ExecutionPolicy::chunkSize(std::size_t bytesPerElement) const noexcept {
+    // a multiple of 64 keeps every chunk but the last on whole packs
+    std::size_t size = ThreadPool::l2CacheSize() / 2 / std::max<std::size_t>(bytesPerElement, 1);
+    return std::max<std::size_t>(size / 64 * 64, 1024);
+}
+
+} // namespace unitized
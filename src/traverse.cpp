@@ -0,0 +1,5 @@
+#include "traverse.h"
+
+#ifndef UNITIZED_HEADER_ONLY
+#include "traverse.inl"
+#endif
@@ -0,0 +1,72 @@
+#ifndef UNITIZED_TRAVERSE_H
+#define UNITIZED_TRAVERSE_H
+
+#include "unitizedglobal.h"
+#include "lengtharray.h"
+#include "anglearray.h"
+#include <cstddef>
+
+namespace unitized {
+
+// Batch reduction of survey shots.  A shot is a distance, an azimuth
+// clockwise from north and an inclination up from horizontal; its deltas are
+// the east, north and up components of the shot vector.
+class Traverse
+{
+public:
+    // Reduces every shot to deltas in unit, through one fused SIMD pass that
+    // converts the distance and takes the sines and cosines of both angles.
+    // The columns must all have the same size; the outputs are replaced.
+    // A parallel policy splits the columns into L2-sized chunks.
+    static UNITIZED_INLINE void toDeltas(const LengthArray& distance, const AngleArray& azimuth,
+                                         const AngleArray& inclination, Length::Unit unit,
+                                         LengthArray& east, LengthArray& north, LengthArray& up,
+                                         const ExecutionPolicy& policy = ExecutionPolicy());
+    static UNITIZED_INLINE void toDeltas(const double* distance, Length::Unit distanceUnit,
+                                         const double* azimuth, Angle::Unit azimuthUnit,
+                                         const double* inclination, Angle::Unit inclinationUnit,
+                                         double* east, double* north, double* up, std::size_t n,
+                                         Length::Unit unit) noexcept;
+    static UNITIZED_INLINE void toDeltas(const double* distance, Length::Unit distanceUnit,
+                                         const double* azimuth, Angle::Unit azimuthUnit,
+                                         const double* inclination, Angle::Unit inclinationUnit,
+                                         double* east, double* north, double* up, std::size_t n,
+                                         Length::Unit unit, const ExecutionPolicy& policy);
+
+    // The inverse, for closures and exports: recovers shots from deltas, with
+    // azimuths in [0, 360) degrees or the equivalent in azimuthUnit.  Delta
+    // columns in different units are converted to east's unit first.
+    static UNITIZED_INLINE void fromDeltas(const LengthArray& east, const LengthArray& north, const LengthArray& up,
+                                           Length::Unit distanceUnit, Angle::Unit azimuthUnit,
+                                           Angle::Unit inclinationUnit, LengthArray& distance,
+                                           AngleArray& azimuth, AngleArray& inclination,
+                                           const ExecutionPolicy& policy = ExecutionPolicy());
+    static UNITIZED_INLINE void fromDeltas(const double* east, const double* north, const double* up,
+                                           Length::Unit unit, double* distance, Length::Unit distanceUnit,
+                                           double* azimuth, Angle::Unit azimuthUnit,
+                                           double* inclination, Angle::Unit inclinationUnit,
+                                           std::size_t n) noexcept;
+    static UNITIZED_INLINE void fromDeltas(const double* east, const double* north, const double* up,
+                                           Length::Unit unit, double* distance, Length::Unit distanceUnit,
+                                           double* azimuth, Angle::Unit azimuthUnit,
+                                           double* inclination, Angle::Unit inclinationUnit,
+                                           std::size_t n, const ExecutionPolicy& policy);
+
+    // Station coordinates along a traverse: out[i] = start + deltas[0] + ...
+    // + deltas[i] in unit, with compensated summation so long traverses don't
+    // drift.  With a parallel policy, large columns are scanned in blocks, one
+    // per thread.
+    static UNITIZED_INLINE LengthArray accumulate(const LengthArray& deltas, Length start, Length::Unit unit,
+                                                  const ExecutionPolicy& policy = ExecutionPolicy());
+    static UNITIZED_INLINE void accumulate(const double* deltas, Length::Unit deltaUnit, double* out, std::size_t n,
+                                           Length start, Length::Unit unit,
+                                           const ExecutionPolicy& policy = ExecutionPolicy());
+};
+
+} // namespace unitized
+
+#ifdef UNITIZED_HEADER_ONLY
+#include "traverse.inl"
+#endif
+
+#endif // UNITIZED_TRAVERSE_H
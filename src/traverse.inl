@@ -0,0 +1,168 @@
+#include "simd.h"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace unitized {
+
+UNITIZED_INLINE void Traverse::toDeltas(const LengthArray& distance, const AngleArray& azimuth,
+                                        const AngleArray& inclination, Length::Unit unit,
+                                        LengthArray& east, LengthArray& north, LengthArray& up,
+                                        const ExecutionPolicy& policy) {
+    assert(azimuth.size() == distance.size() && inclination.size() == distance.size());
+    std::size_t n = distance.size();
+    east = LengthArray(n, unit);
+    north = LengthArray(n, unit);
+    up = LengthArray(n, unit);
+    toDeltas(distance.data(), distance.unit(), azimuth.data(), azimuth.unit(),
+             inclination.data(), inclination.unit(), east.data(), north.data(), up.data(), n, unit, policy);
+}
+
+UNITIZED_INLINE void Traverse::toDeltas(const double* distance, Length::Unit distanceUnit,
+                                        const double* azimuth, Angle::Unit azimuthUnit,
+                                        const double* inclination, Angle::Unit inclinationUnit,
+                                        double* east, double* north, double* up, std::size_t n,
+                                        Length::Unit unit) noexcept {
+    const simd::Kernels& kernels = simd::kernels();
+    double distanceFactor = Length(1, distanceUnit).convertTo(unit);
+    double azimuthRightAngle = Angle::RightAngles[azimuthUnit];
+    double inclinationRightAngle = Angle::RightAngles[inclinationUnit];
+    // the kernel takes radians or a unit it can reduce exactly
+    bool azimuthDirect = azimuthRightAngle || azimuthUnit == Angle::Radians;
+    bool inclinationDirect = inclinationRightAngle || inclinationUnit == Angle::Radians;
+    if (azimuthDirect && inclinationDirect) {
+        kernels.shotDeltas(distance, azimuth, inclination, east, north, up, n,
+                           distanceFactor, azimuthRightAngle, inclinationRightAngle);
+        return;
+    }
+
+    // PercentGrade goes through radians a block at a time, which stays in cache.
+    const std::size_t blockSize = 512;
+    double azimuthRadians[blockSize], inclinationRadians[blockSize];
+    Angle::Converter azimuthToRadians(azimuthUnit, Angle::Radians);
+    Angle::Converter inclinationToRadians(inclinationUnit, Angle::Radians);
+    for (std::size_t i = 0; i < n; i += blockSize) {
+        std::size_t count = std::min(blockSize, n - i);
+        const double* azimuthBlock = azimuth + i;
+        const double* inclinationBlock = inclination + i;
+        if (!azimuthDirect) {
+            azimuthToRadians.apply(azimuthBlock, azimuthRadians, count);
+            azimuthBlock = azimuthRadians;
+        }
+        if (!inclinationDirect) {
+            inclinationToRadians.apply(inclinationBlock, inclinationRadians, count);
+            inclinationBlock = inclinationRadians;
+        }
+        kernels.shotDeltas(distance + i, azimuthBlock, inclinationBlock, east + i, north + i, up + i, count,
+                           distanceFactor, azimuthRightAngle, inclinationRightAngle);
+    }
+}
+
+UNITIZED_INLINE void Traverse::toDeltas(const double* distance, Length::Unit distanceUnit,
+                                        const double* azimuth, Angle::Unit azimuthUnit,
+                                        const double* inclination, Angle::Unit inclinationUnit,
+                                        double* east, double* north, double* up, std::size_t n,
+                                        Length::Unit unit, const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(6 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        toDeltas(distance + begin, distanceUnit, azimuth + begin, azimuthUnit, inclination + begin, inclinationUnit,
+                 east + begin, north + begin, up + begin, end - begin, unit);
+    });
+}
+
+UNITIZED_INLINE void Traverse::fromDeltas(const LengthArray& east, const LengthArray& north, const LengthArray& up,
+                                          Length::Unit distanceUnit, Angle::Unit azimuthUnit,
+                                          Angle::Unit inclinationUnit, LengthArray& distance,
+                                          AngleArray& azimuth, AngleArray& inclination,
+                                          const ExecutionPolicy& policy) {
+    assert(north.size() == east.size() && up.size() == east.size());
+    if (north.unit() != east.unit() || up.unit() != east.unit()) {
+        fromDeltas(east, north.as(east.unit()), up.as(east.unit()), distanceUnit, azimuthUnit, inclinationUnit,
+                   distance, azimuth, inclination, policy);
+        return;
+    }
+    std::size_t n = east.size();
+    distance = LengthArray(n, distanceUnit);
+    azimuth = AngleArray(n, azimuthUnit);
+    inclination = AngleArray(n, inclinationUnit);
+    fromDeltas(east.data(), north.data(), up.data(), east.unit(), distance.data(), distanceUnit,
+               azimuth.data(), azimuthUnit, inclination.data(), inclinationUnit, n, policy);
+}
+
+UNITIZED_INLINE void Traverse::fromDeltas(const double* east, const double* north, const double* up,
+                                          Length::Unit unit, double* distance, Length::Unit distanceUnit,
+                                          double* azimuth, Angle::Unit azimuthUnit,
+                                          double* inclination, Angle::Unit inclinationUnit,
+                                          std::size_t n) noexcept {
+    // PercentGrade is nonlinear, so the kernel leaves it in radians
+    Angle::Unit azimuthKernelUnit = azimuthUnit == Angle::PercentGrade ? Angle::Radians : azimuthUnit;
+    Angle::Unit inclinationKernelUnit = inclinationUnit == Angle::PercentGrade ? Angle::Radians : inclinationUnit;
+    double azimuthRightAngle = Angle::RightAngles[azimuthKernelUnit];
+    double fullTurn = azimuthRightAngle ? 4 * azimuthRightAngle : 2 * Angle::Pi;
+    simd::kernels().deltaShots(east, north, up, distance, azimuth, inclination, n,
+                               Length(1, unit).convertTo(distanceUnit),
+                               Angle::radians(1).convertTo(azimuthKernelUnit),
+                               Angle::radians(1).convertTo(inclinationKernelUnit), fullTurn);
+    if (azimuthKernelUnit != azimuthUnit) {
+        Angle::Converter(Angle::Radians, azimuthUnit).apply(azimuth, azimuth, n);
+    }
+    if (inclinationKernelUnit != inclinationUnit) {
+        Angle::Converter(Angle::Radians, inclinationUnit).apply(inclination, inclination, n);
+    }
+}
+
+UNITIZED_INLINE void Traverse::fromDeltas(const double* east, const double* north, const double* up,
+                                          Length::Unit unit, double* distance, Length::Unit distanceUnit,
+                                          double* azimuth, Angle::Unit azimuthUnit,
+                                          double* inclination, Angle::Unit inclinationUnit,
+                                          std::size_t n, const ExecutionPolicy& policy) {
+    policy.forEachChunk(n, policy.chunkSize(6 * sizeof(double)), [&](std::size_t begin, std::size_t end) {
+        fromDeltas(east + begin, north + begin, up + begin, unit, distance + begin, distanceUnit,
+                   azimuth + begin, azimuthUnit, inclination + begin, inclinationUnit, end - begin);
+    });
+}
+
+UNITIZED_INLINE LengthArray Traverse::accumulate(const LengthArray& deltas, Length start, Length::Unit unit,
+                                                 const ExecutionPolicy& policy) {
+    LengthArray result(deltas.size(), unit);
+    accumulate(deltas.data(), deltas.unit(), result.data(), deltas.size(), start, unit, policy);
+    return result;
+}
+
+// A scan in three passes: each thread totals its block, the block totals are
+// scanned serially, and then each thread scans its block from its offset.
+UNITIZED_INLINE void Traverse::accumulate(const double* deltas, Length::Unit deltaUnit, double* out, std::size_t n,
+                                          Length start, Length::Unit unit, const ExecutionPolicy& policy) {
+    double factor = Length(1, deltaUnit).convertTo(unit);
+    double offset = start.convertTo(unit);
+    const std::size_t minBlockSize = 1 << 16;
+    std::size_t threads = policy.isParallel() ? policy.pool()->size() + 1 : 1;
+    std::size_t blocks = std::min(threads, n / minBlockSize);
+    if (blocks <= 1) {
+        double sum = 0, compensation = 0;
+        simd::kernels().prefixSum(deltas, out, n, sum, compensation, factor, offset);
+        return;
+    }
+
+    std::size_t blockSize = (n + blocks - 1) / blocks;
+    std::vector<double> sums(blocks), compensations(blocks);
+    policy.forEachChunk(n, blockSize, [&](std::size_t begin, std::size_t end) {
+        std::size_t b = begin / blockSize;
+        simd::kernels().sum(deltas + begin, end - begin, sums[b], compensations[b]);
+    });
+
+    // exclusive scan of the totals, so each block starts from the ones before it
+    double sum = 0, compensation = 0;
+    for (std::size_t b = 0; b < blocks; b++) {
+        double total[2] = {sums[b], compensations[b]};
+        sums[b] = sum;
+        compensations[b] = compensation;
+        simd::kernels().sum(total, 2, sum, compensation);
+    }
+
+    policy.forEachChunk(n, blockSize, [&](std::size_t begin, std::size_t end) {
+        std::size_t b = begin / blockSize;
+        simd::kernels().prefixSum(deltas + begin, out + begin, end - begin, sums[b], compensations[b], factor, offset);
+    });
+}
+
+} // namespace unitized
@@ -26,6 +26,9 @@ public:
     static Length inches(double value);
     static Length miles(double value);
 
+    // Unit(0) if name isn't a unit.
+    static Unit parseUnit(const char* name);
+
     static Angle atan2(Length y, Length x);
 
     double convertTo(Unit unit) const;
@@ -86,6 +89,9 @@ public:
     static Angle milsNATO(double value);
     static Angle percentGrade(double value);
 
+    // Unit(0) if name isn't a unit.
+    static Unit parseUnit(const char* name);
+
     static double sin(Angle angle);
     static double cos(Angle angle);
     static double tan(Angle angle);
@@ -0,0 +1,16 @@
+#ifndef UNITIZED_UNITIZEDGLOBAL_H
+#define UNITIZED_UNITIZEDGLOBAL_H
+
+// Define UNITIZED_HEADER_ONLY to get every definition from the headers
+// instead of the unitized shared library.  In that mode the value types are
+// constexpr and inlinable; otherwise the same definitions are compiled once
+// into the library (see the *.inl files and their *.cpp wrappers).
+#ifdef UNITIZED_HEADER_ONLY
+#  define UNITIZED_INLINE inline
+#  define UNITIZED_CONSTEXPR constexpr
+#else
+#  define UNITIZED_INLINE
+#  define UNITIZED_CONSTEXPR
+#endif
+
+#endif // UNITIZED_UNITIZEDGLOBAL_H
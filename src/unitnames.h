@@ -0,0 +1,79 @@
+#ifndef UNITIZED_UNITNAMES_H
+#define UNITIZED_UNITNAMES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace unitized {
+
+namespace detail {
+
+struct UnitName {
+    std::string_view name;
+    int unit;
+};
+
+constexpr unsigned char foldCase(unsigned char c) noexcept {
+    return c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+}
+
+// FNV-1a over the case-folded bytes, starting from seed instead of the
+// usual offset basis.
+constexpr std::uint32_t hashUnitName(std::string_view name, std::uint32_t seed) noexcept {
+    std::uint32_t hash = seed;
+    for (char c : name) hash = (hash ^ foldCase(static_cast<unsigned char>(c))) * 16777619u;
+    return hash;
+}
+
+// A perfect hash table over lower case unit names, built at compile time: the
+// seed (found by search offline) gives every name a slot of its own, so a
+// lookup hashes the name once and compares it with a single candidate.
+// perfect is false if two names share a slot, which the owner checks with a
+// static_assert whenever its names change.
+template <std::size_t N>
+class UnitNameTable
+{
+public:
+    static constexpr int Bits = 6;
+    static_assert(N <= (1u << Bits) / 2, "too many names for the table to stay sparse");
+
+    constexpr UnitNameTable(const UnitName (&names)[N], std::uint32_t seed) noexcept:
+        names(names), seed(seed), slots(), perfect(true) {
+        for (std::size_t i = 0; i < N; i++) {
+            std::uint8_t& slot = slots[slotOf(names[i].name)];
+            if (slot) perfect = false;
+            slot = static_cast<std::uint8_t>(i + 1);
+        }
+    }
+
+    // The unit named by name in any ASCII case, or 0.
+    constexpr int find(std::string_view name) const noexcept {
+        std::uint8_t slot = slots[slotOf(name)];
+        if (!slot) return 0;
+        const UnitName& candidate = names[slot - 1];
+        if (candidate.name.size() != name.size()) return 0;
+        for (std::size_t i = 0; i < name.size(); i++) {
+            if (foldCase(static_cast<unsigned char>(name[i])) != static_cast<unsigned char>(candidate.name[i])) {
+                return 0;
+            }
+        }
+        return candidate.unit;
+    }
+
+    const UnitName* names;
+    std::uint32_t seed;
+    std::uint8_t slots[1u << Bits];
+    bool perfect;
+
+private:
+    constexpr std::size_t slotOf(std::string_view name) const noexcept {
+        return hashUnitName(name, seed) >> (32 - Bits);
+    }
+};
+
+} // namespace detail
+
+} // namespace unitized
+
+#endif // UNITIZED_UNITNAMES_H
@@ -0,0 +1,65 @@
+#include "catch.hpp"
+#include "../src/anglearray.h"
+
+using namespace unitized;
+
+TEST_CASE( "AngleArray" , "[unitized, angle]" ) {
+    AngleArray degrees({0, 45, 90, -30}, Angle::Degrees);
+
+    SECTION("elements") {
+        CHECK(degrees.size() == 4);
+        CHECK(degrees.unit() == Angle::Degrees);
+        CHECK(degrees[1].equals(Angle::gradians(50)));
+        degrees.set(0, Angle::milsNATO(1600));
+        CHECK(degrees.data()[0] == 90);
+    }
+    SECTION("conversions") {
+        AngleArray gradians = degrees.as(Angle::Gradians);
+        std::vector<double> grades = degrees.convertTo(Angle::PercentGrade);
+        for (std::size_t i = 0; i < degrees.size(); i++) {
+            CHECK(gradians.data()[i] == degrees[i].toGradians());
+            CHECK(grades[i] == degrees[i].toPercentGrade());
+        }
+        CHECK(gradians.equals(degrees));
+    }
+    SECTION("arithmetic and comparison") {
+        AngleArray gradians({100, 100, 100, 100}, Angle::Gradians);
+        for (std::size_t i = 0; i < degrees.size(); i++) {
+            CHECK(degrees.add(gradians)[i].equals(degrees[i].add(gradians[i])));
+            CHECK(degrees.sub(gradians)[i].equals(degrees[i].sub(gradians[i])));
+            CHECK(degrees.mul(2)[i].equals(degrees[i].mul(2)));
+        }
+        CHECK(degrees.compareTo(gradians) == std::vector<int>({-1, -1, 0, -1}));
+    }
+    SECTION("trigonometry") {
+        double sin[4], cos[4], tan[4];
+        AngleArray gradians = degrees.as(Angle::Gradians);
+        AngleArray::sin(gradians, sin);
+        AngleArray::cos(gradians, cos);
+        AngleArray::tan(gradians, tan);
+        double sincosSin[4], sincosCos[4];
+        AngleArray::sincos(gradians, sincosSin, sincosCos);
+        for (std::size_t i = 0; i < degrees.size(); i++) {
+            CHECK(sin[i] == Approx(Angle::sin(degrees[i])).margin(1e-15));
+            CHECK(cos[i] == Approx(Angle::cos(degrees[i])).margin(1e-15));
+            if (i != 2) CHECK(tan[i] == Approx(Angle::tan(degrees[i])));
+            CHECK(sincosSin[i] == sin[i]);
+            CHECK(sincosCos[i] == cos[i]);
+        }
+
+        double values[] = {-1, -0.5, 0, 0.5, 1};
+        AngleArray asin = AngleArray::asin(values, 5);
+        AngleArray acos = AngleArray::acos(values, 5);
+        AngleArray atan = AngleArray::atan(values, 5);
+        AngleArray atan2 = AngleArray::atan2(values, sin, 4);
+        CHECK(asin.unit() == Angle::Radians);
+        for (int i = 0; i < 5; i++) {
+            CHECK(asin.data()[i] == Approx(Angle::asin(values[i]).toRadians()));
+            CHECK(acos.data()[i] == Approx(Angle::acos(values[i]).toRadians()));
+            CHECK(atan.data()[i] == Approx(Angle::atan(values[i]).toRadians()));
+        }
+        for (int i = 0; i < 4; i++) {
+            CHECK(atan2.data()[i] == Approx(Angle::atan2(values[i], sin[i]).toRadians()));
+        }
+    }
+}
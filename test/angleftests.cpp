@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "../src/anglef.h"
+#include <cmath>
+#include <vector>
+
+using namespace unitized;
+
+TEST_CASE( "AngleF" , "[unitized, anglef]" ) {
+    SECTION( "narrowing and widening" ) {
+        AngleF angle(Angle::gradians(100));
+        CHECK(angle.unit == Angle::Gradians);
+        Angle wide = angle;
+        CHECK(wide.equals(Angle::degrees(90)));
+        CHECK(angle.convertTo(Angle::Degrees) == 90);
+
+        AngleF result = AngleF::degrees(0);
+        CHECK(AngleF::narrow(Angle::percentGrade(12.5), result));
+        CHECK(result.unit == Angle::PercentGrade);
+        CHECK_FALSE(AngleF::narrow(Angle::radians(-1e300), result));
+        CHECK(result.isInfinite());
+        CHECK(result.isNegative());
+    }
+    SECTION( "arithmetic" ) {
+        AngleF sum = AngleF::degrees(45).add(AngleF::gradians(50));
+        CHECK(sum.convertTo(Angle::Degrees) == 90);
+        CHECK(sum.sub(AngleF::milsNATO(1600)).isZero());
+        CHECK(sum.as(Angle::Gradians).equals(AngleF::gradians(100)));
+        CHECK(AngleF::percentGrade(100).convertTo(Angle::Degrees) == Approx(45));
+        CHECK(AngleF::degrees(370).mod(AngleF::degrees(360)).equals(AngleF::degrees(10)));
+        CHECK(AngleF::radians(1).compareTo(AngleF::degrees(57)) > 0);
+        CHECK(sizeof(AngleF) == 8);
+    }
+    SECTION( "trigonometry" ) {
+        CHECK(AngleF::sin(AngleF::degrees(30)) == 0.5f);
+        CHECK(AngleF::cos(AngleF::milsNATO(1600)) == 0);
+        CHECK(AngleF::tan(AngleF::gradians(50)) == 1);
+        CHECK(AngleF::atan2(1, 1).convertTo(Angle::Degrees) == Approx(45));
+        CHECK(AngleF::asin(1).convertTo(Angle::Radians) == static_cast<float>(std::asin(1.0)));
+
+        for (Angle::Unit unit : {Angle::Degrees, Angle::Gradians, Angle::Radians, Angle::MilsNATO, Angle::PercentGrade}) {
+            INFO(unit);
+            std::vector<float> angles;
+            for (int i = -50; i <= 50; i++) angles.push_back(i * 7.25f);
+            std::vector<float> sin(angles.size()), cos(angles.size()), tan(angles.size()), sin2(angles.size()), cos2(angles.size());
+            AngleF::sin(angles.data(), sin.data(), angles.size(), unit);
+            AngleF::cos(angles.data(), cos.data(), angles.size(), unit);
+            AngleF::tan(angles.data(), tan.data(), angles.size(), unit);
+            AngleF::sincos(angles.data(), sin2.data(), cos2.data(), angles.size(), unit);
+            for (std::size_t i = 0; i < angles.size(); i++) {
+                Angle angle(angles[i], unit);
+                CHECK(sin[i] == Approx(Angle::sin(angle)).margin(1e-6));
+                CHECK(cos[i] == Approx(Angle::cos(angle)).margin(1e-6));
+                CHECK(tan[i] == Approx(Angle::tan(angle)).epsilon(1e-5).margin(1e-6));
+                CHECK(sin2[i] == sin[i]);
+                CHECK(cos2[i] == cos[i]);
+            }
+        }
+    }
+    SECTION( "converter" ) {
+        AngleF::Converter degreesToGrade(Angle::Degrees, Angle::PercentGrade);
+        CHECK(degreesToGrade(45) == Approx(100));
+        std::vector<double> wide = {0, 45, -30};
+        std::vector<float> out(3);
+        CHECK(degreesToGrade.narrow(wide.data(), out.data(), 3));
+        CHECK(out[1] == Approx(100));
+        std::vector<double> back(3);
+        AngleF::Converter(Angle::PercentGrade, Angle::Degrees).widen(out.data(), back.data(), 3);
+        CHECK(back[2] == Approx(-30).epsilon(1e-6));
+        std::vector<float> floats = {90, 180};
+        AngleF::Converter(Angle::Degrees, Angle::MilsNATO).apply(floats.data(), floats.data(), 2);
+        CHECK(floats[0] == 1600);
+        CHECK(floats[1] == 3200);
+    }
+}
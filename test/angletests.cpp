@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "../src/angle.h"
+#include <algorithm>
 #include <cmath>
 #include <initializer_list>
 
@@ -19,6 +20,28 @@ void checkConversions(std::initializer_list<Angle> values, double epsilon) {
     }
 }
 
+// The conversions Angle made before its factor matrix, through degrees.
+double oldToDegrees(double value, Angle::Unit from) {
+    switch (from) {
+    case Angle::Degrees: return value;
+    case Angle::Gradians: return value * 180 / 200;
+    case Angle::Radians: return value * 180 / M_PI;
+    case Angle::MilsNATO: return value * 180 / 3200;
+    case Angle::PercentGrade: return std::atan(value * 0.01) * 180 / M_PI;
+    }
+    return NAN;
+}
+double oldFromDegrees(double value, Angle::Unit to) {
+    switch (to) {
+    case Angle::Degrees: return value;
+    case Angle::Gradians: return value * 200 / 180;
+    case Angle::Radians: return value * M_PI / 180;
+    case Angle::MilsNATO: return value * 3200 / 180;
+    case Angle::PercentGrade: return std::tan(value * M_PI / 180) * 100;
+    }
+    return NAN;
+}
+
 TEST_CASE( "Angle" , "[unitized, angle]" ) {
     SECTION("basic conversions") {
         checkConversions({
@@ -44,5 +67,95 @@ TEST_CASE( "Angle" , "[unitized, angle]" ) {
         CHECK(Angle::acos(1).toRadians() == 0.0);
         CHECK(Angle::atan(1).toRadians() == M_PI_4);
         CHECK(Angle::atan2(2, 1).toRadians() == atan2(2, 1));
+
+        CHECK(!std::signbit(Angle::cos(Angle::degrees(90))));
+        CHECK(Angle::sin(Angle::degrees(-270)) == 1.0);
+        CHECK(Angle::sin(Angle::degrees(3600)) == 0.0);
+        CHECK(Angle::sin(Angle::degrees(30)) == Approx(0.5).epsilon(1e-15));
+        CHECK(Angle::cos(Angle::gradians(400)) == 1.0);
+        CHECK(Angle::sin(Angle::gradians(200)) == 0.0);
+        CHECK(Angle::cos(Angle::milsNATO(3200)) == -1.0);
+        CHECK(Angle::tan(Angle::degrees(180)) == 0.0);
+        CHECK(Angle::tan(Angle::degrees(135)) == Approx(-1).epsilon(1e-15));
+        CHECK(std::isnan(Angle::sin(Angle::degrees(INFINITY))));
+
+        for (Angle angle : {Angle::degrees(30), Angle::gradians(-150), Angle::radians(2), Angle::percentGrade(40)}) {
+            double sin, cos;
+            Angle::sincos(angle, sin, cos);
+            CHECK(sin == Approx(Angle::sin(angle)).epsilon(1e-15));
+            CHECK(cos == Approx(Angle::cos(angle)).epsilon(1e-15));
+        }
+        double sin, cos;
+        Angle::sincos(Angle::milsNATO(-1600), sin, cos);
+        CHECK(sin == -1.0);
+        CHECK(cos == 0.0);
+    }
+    SECTION( "factor matrix" ) {
+        for (int from = Angle::Degrees; from <= Angle::PercentGrade; from++) {
+            for (int to = Angle::Degrees; to <= Angle::PercentGrade; to++) {
+                INFO(from << " to " << to);
+                for (double value : {1.0, -2.5, 30.0}) {
+                    double expected = oldFromDegrees(oldToDegrees(value, Angle::Unit(from)), Angle::Unit(to));
+                    CHECK(Angle(value, Angle::Unit(from)).convertTo(Angle::Unit(to)) ==
+                          Approx(expected).epsilon(1e-14));
+                }
+            }
+        }
+    }
+    SECTION( "invalid units" ) {
+        CHECK(std::isnan(Angle(5, Angle::parseUnit("bogus")).toDegrees()));
+        CHECK(std::isnan(Angle::degrees(5).convertTo(Angle::Unit(0))));
+        CHECK(std::isnan(Angle::degrees(5).convertTo(Angle::Unit(42))));
+        CHECK(std::isnan(Angle(5, Angle::Unit(0)).convertTo(Angle::PercentGrade)));
+        CHECK(std::isnan(Angle::percentGrade(5).convertTo(Angle::Unit(0))));
+        CHECK(std::isnan(Angle::Converter(Angle::Unit(0), Angle::Unit(0))(1)));
+    }
+    SECTION( "converter" ) {
+        double in[] = {0, 45, -30, 89.5};
+        double out[4];
+        for (Angle::Unit from : {Angle::Degrees, Angle::Radians, Angle::PercentGrade}) {
+            for (Angle::Unit to : {Angle::Gradians, Angle::Radians, Angle::PercentGrade}) {
+                Angle::Converter converter(from, to);
+                converter.apply(in, out, 4);
+                for (int i = 0; i < 4; i++) {
+                    CHECK(out[i] == Angle(in[i], from).convertTo(to));
+                    CHECK(converter(in[i]) == out[i]);
+                }
+            }
+        }
+    }
+    SECTION( "assignment" ) {
+        Angle a = Angle::degrees(10), b = Angle::gradians(10);
+        std::swap(a, b);
+        CHECK(a.unit == Angle::Gradians);
+        CHECK(b.unit == Angle::Degrees);
+        a = b;
+        CHECK(a.unit == Angle::Degrees);
+        CHECK(a.toDegrees() == 10);
+    }
+    SECTION( "unit names" ) {
+        CHECK(Angle::parseUnit("deg") == Angle::Degrees);
+        CHECK(Angle::parseUnit("DEG") == Angle::Degrees);
+        CHECK(Angle::parseUnit("\xc2\xb0") == Angle::Degrees);
+        CHECK(Angle::parseUnit("grad") == Angle::Gradians);
+        CHECK(Angle::parseUnit("gon") == Angle::Gradians);
+        CHECK(Angle::parseUnit("Radians") == Angle::Radians);
+        CHECK(Angle::parseUnit("mils") == Angle::MilsNATO);
+        CHECK(Angle::parseUnit("%") == Angle::PercentGrade);
+        CHECK(Angle::parseUnit("percent") == Angle::PercentGrade);
+
+        CHECK(Angle::parseUnit("") == 0);
+        CHECK(Angle::parseUnit("degs") == 0);
+        CHECK(Angle::parseUnit("ft") == 0);
+        CHECK(Angle::parseUnit("\xc3\xb0") == 0);
+    }
+
+#ifdef UNITIZED_HEADER_ONLY
+    SECTION( "constant expressions" ) {
+        static_assert(Angle::degrees(90).convertTo(Angle::Gradians) == 100, "degrees to gradians");
+        static_assert(Angle::milsNATO(1600).sub(Angle::degrees(45)).toDegrees() == 45, "sub");
+        static_assert(Angle::gradians(50).equals(Angle::degrees(45)), "equals");
+        static_assert(Angle::parseUnit("MILS") == Angle::MilsNATO, "parseUnit");
     }
+#endif
 }
@@ -0,0 +1,78 @@
+#include "catch.hpp"
+#include "../src/canonical.h"
+#include <algorithm>
+#include <vector>
+
+using namespace unitized;
+
+TEST_CASE( "CanonicalLength" , "[unitized, canonical]" ) {
+    SECTION( "storage" ) {
+        CanonicalLength length(10, Length::Feet);
+        CHECK(length.unit == Length::Feet);
+        CHECK(length.toMeters() == Length::feet(10).toMeters());
+        CHECK(length.convertTo(Length::Feet) == Approx(10));
+        CHECK(length.length().unit == Length::Feet);
+        CHECK(CanonicalLength(Length::yards(2)).toMeters() == Length::yards(2).toMeters());
+        CHECK(length.as(Length::Meters).toMeters() == length.toMeters());
+        CHECK(length.as(Length::Meters).unit == Length::Meters);
+    }
+    SECTION( "arithmetic in meters" ) {
+        CanonicalLength sum = CanonicalLength(1, Length::Feet).add(Length::inches(6));
+        CHECK(sum.unit == Length::Feet);
+        CHECK(sum.toMeters() == Length::feet(1).toMeters() + Length::inches(6).toMeters());
+        CHECK(sum.convertTo(Length::Feet) == Approx(1.5));
+        CHECK(sum.sub(Length::feet(1)).convertTo(Length::Inches) == Approx(6));
+        CHECK(sum.mul(2).div(3).convertTo(Length::Feet) == Approx(1));
+        CHECK(sum.divUnitless(Length::inches(6)) == Approx(3));
+        CHECK(sum.negate().abs().equals(sum));
+        CHECK(CanonicalLength::meters(0).isZero());
+        CHECK(CanonicalLength::meters(NAN).isNaN());
+    }
+    SECTION( "comparison across units" ) {
+        CHECK(CanonicalLength(Length::meters(1)).equals(Length::centimeters(100)));
+        CHECK(CanonicalLength(Length::inches(12)).compareTo(Length::yards(1)) < 0);
+        CHECK(CanonicalLength(Length::miles(1)).compareTo(Length::kilometers(1)) > 0);
+
+        std::vector<CanonicalLength> lengths = {Length::feet(4), Length::meters(1), Length::inches(13), Length::yards(1)};
+        std::sort(lengths.begin(), lengths.end(), [](CanonicalLength a, CanonicalLength b) { return a.compareTo(b) < 0; });
+        CHECK(lengths[0].unit == Length::Inches);
+        CHECK(lengths[1].unit == Length::Yards);
+        CHECK(lengths[2].unit == Length::Meters);
+        CHECK(lengths[3].unit == Length::Feet);
+    }
+#ifdef UNITIZED_HEADER_ONLY
+    SECTION( "constant expressions" ) {
+        static_assert(CanonicalLength(Length::kilometers(1)).add(Length::meters(500)).toMeters() == 1500, "add");
+        static_assert(CanonicalLength(Length::inches(3)).compareTo(Length::feet(1)) < 0, "compareTo");
+    }
+#endif
+}
+
+TEST_CASE( "CanonicalAngle" , "[unitized, canonical]" ) {
+    SECTION( "storage" ) {
+        CanonicalAngle angle(100, Angle::Gradians);
+        CHECK(angle.unit == Angle::Gradians);
+        CHECK(angle.toDegrees() == 90);
+        CHECK(angle.angle().unit == Angle::Gradians);
+        CHECK(angle.angle().toGradians() == 100);
+        CHECK(angle.as(Angle::MilsNATO).convertTo(Angle::MilsNATO) == 1600);
+        CHECK(CanonicalAngle(100, Angle::PercentGrade).toDegrees() == Approx(45));
+    }
+    SECTION( "arithmetic in degrees" ) {
+        CanonicalAngle sum = CanonicalAngle(Angle::degrees(45)).add(Angle::gradians(50));
+        CHECK(sum.unit == Angle::Degrees);
+        CHECK(sum.toDegrees() == 90);
+        CHECK(sum.sub(Angle::milsNATO(1600)).isZero());
+        CHECK(sum.mul(2).div(4).toDegrees() == 45);
+        CHECK(sum.divUnitless(Angle::degrees(30)) == 3);
+        CHECK(sum.negate().abs().equals(sum));
+        CHECK(CanonicalAngle::degrees(NAN).isNaN());
+        // grades add as angles
+        CHECK(CanonicalAngle(100, Angle::PercentGrade).add(Angle::degrees(45)).angle().toDegrees() == Approx(90));
+    }
+    SECTION( "comparison across units" ) {
+        CHECK(CanonicalAngle(Angle::degrees(90)).equals(Angle::gradians(100)));
+        CHECK(CanonicalAngle(Angle::radians(1)).compareTo(Angle::degrees(57)) > 0);
+        CHECK(CanonicalAngle(Angle::milsNATO(100)).compareTo(Angle::degrees(6)) < 0);
+    }
+}
@@ -0,0 +1,170 @@
+#include "catch.hpp"
+#include "../src/compass.h"
+#include <cmath>
+#include <cstring>
+#include <string>
+
+using namespace unitized;
+
+namespace {
+
+const char* const SecretCave =
+    "SECRET CAVE\r\n"
+    "SURVEY NAME: A\r\n"
+    "SURVEY DATE: 7 10 79  COMMENT:Entrance Passage\r\n"
+    "SURVEY TEAM:\r\n"
+    "D.SMITH,R.BROWN,S.MURPHY\r\n"
+    "DECLINATION:    1.00  FORMAT: DDDDLUDRADLN  CORRECTIONS:  2.00 3.00 4.00\r\n"
+    "\r\n"
+    "        FROM           TO   LENGTH  BEARING      INC     LEFT       UP     DOWN    RIGHT   FLAGS  COMMENTS\r\n"
+    "\r\n"
+    "          A2           A1    12.50   123.00    -3.00     5.00     0.00     0.00     1.50\r\n"
+    "          A2           A3    30.22   155.00    14.50     3.00    -9.90    12.00     2.00  #|LP#  big room\r\n"
+    "\f\r\n"
+    "SECRET CAVE\r\n"
+    "SURVEY NAME: B\r\n"
+    "SURVEY DATE: 7 11 79  COMMENT:Back\r\n"
+    "SURVEY TEAM:\r\n"
+    "D.SMITH\r\n"
+    "DECLINATION:   -2.50  FORMAT: DDDDLUDRADLBF  CORRECTIONS:  0.00 0.00 0.00 CORRECTIONS2:  1.00 -1.00\r\n"
+    "\r\n"
+    "        FROM           TO   LENGTH  BEARING      INC     LEFT       UP     DOWN    RIGHT   AZM2   INC2   FLAGS  COMMENTS\r\n"
+    "\r\n"
+    "          A3           B1    10.00    90.00     0.00     1.00     2.00     3.00     4.00   270.00   0.50\r\n"
+    "          B1           B2     5.00   180.00   -90.00     1.00     2.00     3.00     4.00  -999.00 -999.00 #|X#\r\n"
+    "          B2           B3     7.00   270.00    45.00     1.00     2.00     3.00     4.00    90.00 -45.00  no flags\r\n"
+    "\f\r\n"
+    "\x1a";
+
+void checkSecretCave(const CompassDat& dat) {
+    REQUIRE(dat.surveys.size() == 2);
+    const CompassSurvey& a = dat.surveys[0];
+    CHECK(a.cave == "SECRET CAVE");
+    CHECK(a.name == "A");
+    CHECK(a.date == "7 10 79");
+    CHECK(a.comment == "Entrance Passage");
+    CHECK(a.team == "D.SMITH,R.BROWN,S.MURPHY");
+    CHECK(a.declination.toDegrees() == 1);
+    CHECK(a.format == "DDDDLUDRADLN");
+    CHECK(a.azimuthCorrection.toDegrees() == 2);
+    CHECK(a.inclinationCorrection.toDegrees() == 3);
+    CHECK(a.lengthCorrection.toFeet() == 4);
+    CHECK(!a.hasBacksights);
+    CHECK(a.firstShot == 0);
+    CHECK(a.shotCount == 2);
+
+    const CompassSurvey& b = dat.surveys[1];
+    CHECK(b.name == "B");
+    CHECK(b.declination.toDegrees() == -2.5);
+    CHECK(b.backAzimuthCorrection.toDegrees() == 1);
+    CHECK(b.backInclinationCorrection.toDegrees() == -1);
+    CHECK(b.hasBacksights);
+    CHECK(b.firstShot == 2);
+    CHECK(b.shotCount == 3);
+
+    const CompassShots& shots = dat.shots;
+    REQUIRE(shots.size() == 5);
+    CHECK(shots.length.unit() == Length::Feet);
+    CHECK(shots.azimuth.unit() == Angle::Degrees);
+    CHECK(shots.survey[1] == 0);
+    CHECK(shots.survey[2] == 1);
+    CHECK(shots.from[0] == "A2");
+    CHECK(shots.to[0] == "A1");
+    CHECK(shots.to[4] == "B3");
+    CHECK(shots.length[1].toFeet() == 30.22);
+    CHECK(shots.azimuth[1].toDegrees() == 155);
+    CHECK(shots.inclination[1].toDegrees() == 14.5);
+    CHECK(shots.left[1].toFeet() == 3);
+    CHECK(shots.up[1].isNaN());
+    CHECK(shots.down[1].toFeet() == 12);
+    CHECK(shots.right[1].toFeet() == 2);
+    CHECK(shots.backAzimuth[0].isNaN());
+    CHECK(shots.backAzimuth[2].toDegrees() == 270);
+    CHECK(shots.backInclination[2].toDegrees() == 0.5);
+    CHECK(shots.backAzimuth[3].isNaN());
+    CHECK(shots.backInclination[3].isNaN());
+    CHECK(shots.inclination[3].toDegrees() == -90);
+    CHECK(shots.flags[0] == 0);
+    CHECK(shots.flags[1] == (CompassShots::ExcludeFromLength | CompassShots::ExcludeFromPlotting));
+    CHECK(shots.flags[3] == CompassShots::ExcludeFromAll);
+    CHECK(shots.comment[0] == "");
+    CHECK(shots.comment[1] == "big room");
+    CHECK(shots.comment[4] == "no flags");
+}
+
+} // namespace
+
+TEST_CASE( "Compass .DAT" , "[unitized, compass]" ) {
+    CompassDat dat;
+
+    SECTION( "sequential" ) {
+        CompassResult result = readCompassDat(SecretCave, dat);
+        CHECK(result);
+        CHECK(result.ptr == SecretCave + std::strlen(SecretCave));
+        checkSecretCave(dat);
+    }
+
+    SECTION( "parallel" ) {
+        ThreadPool pool(3);
+        // many copies, so every thread gets surveys
+        std::string text;
+        for (int i = 0; i < 100; i++) text += SecretCave;
+        CHECK(readCompassDat(text, dat, ExecutionPolicy::parallel(pool)));
+        REQUIRE(dat.surveys.size() == 200);
+        REQUIRE(dat.shots.size() == 500);
+        for (std::size_t i = 0; i < dat.shots.size(); i++) {
+            CHECK(dat.shots.survey[i] == i / 5 * 2 + (i % 5 >= 2));
+            CHECK(dat.shots.length.data()[i] == dat.shots.length.data()[i % 5]);
+        }
+        CHECK(dat.surveys[199].firstShot == 497);
+    }
+
+    SECTION( "errors" ) {
+        std::string text = SecretCave;
+        std::size_t at = text.find("155.00");
+        text[at + 1] = 'x';
+        CompassResult result = readCompassDat(text, dat);
+        CHECK(result.error == CompassError::InvalidNumber);
+        CHECK(result.ptr == text.data() + at);
+        CHECK(dat.surveys.empty());
+        CHECK(dat.shots.size() == 0);
+
+        text = SecretCave;
+        at = text.find(" 0.50");
+        text.erase(at, 5);
+        result = readCompassDat(text, dat);
+        CHECK(result.error == CompassError::MissingField);
+
+        text = SecretCave;
+        at = text.find("DECLINATION:   -2.50");
+        text.erase(at, 3);
+        result = readCompassDat(text, dat);
+        CHECK(result.error == CompassError::MissingHeader);
+        CHECK(std::string_view(result.ptr, 12) == "        FROM");
+    }
+
+    SECTION( "first error in the file" ) {
+        // a bad shot in survey A and a bad header in survey B, and the reverse
+        std::string shotFirst = SecretCave;
+        std::size_t shot = shotFirst.find("12.50");
+        shotFirst.replace(shot, 5, "abc  ");
+        shotFirst.erase(shotFirst.find("DECLINATION:   -2.50"), 3);
+
+        std::string headerFirst = SecretCave;
+        headerFirst.erase(headerFirst.find("DECLINATION:    1.00"), 3);
+        headerFirst.replace(headerFirst.find("10.00"), 5, "abc  ");
+
+        ThreadPool pool(3);
+        for (const ExecutionPolicy& policy : {ExecutionPolicy(), ExecutionPolicy::parallel(pool)}) {
+            CompassResult result = readCompassDat(shotFirst, dat, policy);
+            CHECK(result.error == CompassError::InvalidNumber);
+            CHECK(result.ptr == shotFirst.data() + shot);
+            CHECK(dat.shots.size() == 0);
+
+            result = readCompassDat(headerFirst, dat, policy);
+            CHECK(result.error == CompassError::MissingHeader);
+            CHECK(result.ptr < headerFirst.data() + headerFirst.find("SURVEY NAME: B"));
+            CHECK(dat.shots.size() == 0);
+        }
+    }
+}
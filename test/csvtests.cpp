@@ -0,0 +1,133 @@
+#include "catch.hpp"
+#include "../src/csv.h"
+#include <cmath>
+#include <random>
+#include <string>
+
+using namespace unitized;
+
+TEST_CASE( "Load CSV" , "[unitized, csv]" ) {
+    LengthArray distances(Length::Meters);
+    AngleArray azimuths(Angle::Degrees);
+    AngleArray inclinations(Angle::Degrees);
+
+    SECTION( "columns and units" ) {
+        std::string_view text =
+            "from,to,distance,azimuth,inclination\n"
+            "A1,A2,10,90,-5\n"
+            "A2,A3, 2.5 ,100, 0\r\n"
+            "\n"
+            "A3,A4,-1e1,+200,12.5,extra\n"
+            "A4,A5,,0,";
+        CsvResult result = loadCsv(text, {
+            CsvColumn::skip(), CsvColumn::skip(),
+            CsvColumn::length(distances, Length::Feet),
+            CsvColumn::angle(azimuths, Angle::Gradians),
+            CsvColumn::angle(inclinations, Angle::Degrees)
+        }, ',', 1);
+        CHECK(result);
+        CHECK(result.rows == 4);
+        REQUIRE(distances.size() == 4);
+        REQUIRE(azimuths.size() == 4);
+        REQUIRE(inclinations.size() == 4);
+        CHECK(distances.unit() == Length::Meters);
+        CHECK(distances[0].toMeters() == Approx(3.048));
+        CHECK(distances[1].toFeet() == Approx(2.5));
+        CHECK(distances[2].toFeet() == Approx(-10));
+        CHECK(distances[3].isNaN());
+        CHECK(azimuths[0].toDegrees() == Approx(81));
+        CHECK(azimuths[2].toDegrees() == Approx(180));
+        CHECK(inclinations[0].toDegrees() == -5);
+        CHECK(inclinations[1].toDegrees() == 0);
+        CHECK(inclinations[2].toDegrees() == 12.5);
+        CHECK(inclinations[3].isNaN());
+    }
+
+    SECTION( "tabs" ) {
+        CsvResult result = loadCsv("1\t2\n3\t4\n", {
+            CsvColumn::length(distances, Length::Meters),
+            CsvColumn::angle(azimuths, Angle::Degrees)
+        }, '\t');
+        CHECK(result.rows == 2);
+        CHECK(distances.data()[1] == 3);
+        CHECK(azimuths.data()[1] == 4);
+    }
+
+    SECTION( "appends" ) {
+        distances.push_back(Length::meters(7));
+        CHECK(loadCsv("1\n2\n", {CsvColumn::length(distances, Length::Meters)}).rows == 2);
+        REQUIRE(distances.size() == 3);
+        CHECK(distances.data()[0] == 7);
+        CHECK(distances.data()[2] == 2);
+    }
+
+    SECTION( "errors" ) {
+        std::vector<CsvColumn> schema = {
+            CsvColumn::length(distances, Length::Feet),
+            CsvColumn::angle(azimuths, Angle::Degrees)
+        };
+        CsvResult result = loadCsv("1,2\n3,4\n5,6ft\n7,8\n", schema);
+        CHECK(result.error == CsvError::InvalidNumber);
+        CHECK(result.rows == 2);
+        CHECK(result.line == 3);
+        CHECK(result.column == 1);
+        CHECK(distances.size() == 2);
+        CHECK(azimuths.size() == 2);
+        CHECK(distances[1].toFeet() == Approx(3));
+
+        distances.clear();
+        azimuths.clear();
+        result = loadCsv("h\n1,2\n\n3\n", schema, ',', 1);
+        CHECK(result.error == CsvError::MissingField);
+        CHECK(result.rows == 1);
+        CHECK(result.line == 4);
+        CHECK(result.column == 1);
+        CHECK(distances.size() == 1);
+
+        // blocks of 4 to 16 bytes
+        distances.clear();
+        azimuths.clear();
+        result = detail::loadCsv("1,2\n\n3,4\n5,6789012345678\n7,8\n", schema, ',', 0, 4, 16);
+        CHECK(result);
+        CHECK(result.rows == 4);
+        distances.clear();
+        azimuths.clear();
+        result = detail::loadCsv("1,2\n\n3,4\n5,67890123456789\n7,8\n", schema, ',', 0, 4, 16);
+        CHECK(result.error == CsvError::RowTooLong);
+        CHECK(result.rows == 2);
+        CHECK(result.line == 4);
+        CHECK(distances.size() == 2);
+    }
+
+    SECTION( "rows across blocks" ) {
+        // many blocks, and a row longer than one
+        std::mt19937_64 random(1);
+        std::string text;
+        std::vector<double> expected;
+        for (int i = 0; i < 20000; i++) {
+            double value = std::uniform_real_distribution<double>(-1000, 1000)(random);
+            expected.push_back(value);
+            text += std::to_string(i) + ',' + std::string(random() % 64, ' ') + std::to_string(value) + '\n';
+            if (i == 7777) text += std::string(200000, 'x') + '\n';
+        }
+        CsvResult result = loadCsv(text, {CsvColumn::skip(), CsvColumn::length(distances, Length::Meters)});
+        CHECK(result.error == CsvError::MissingField);
+        CHECK(result.rows == 7778);
+        CHECK(result.line == 7779);
+        CHECK(result.column == 1);
+
+        distances.clear();
+        result = loadCsv(text, {CsvColumn::length(distances, Length::Meters)}, ';');
+        CHECK(result.error == CsvError::InvalidNumber);
+
+        distances.clear();
+        std::string::size_type x = text.find('x');
+        text.erase(x, 200001);
+        result = loadCsv(text, {CsvColumn::skip(), CsvColumn::length(distances, Length::Meters)});
+        CHECK(result);
+        REQUIRE(distances.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            CHECK(distances.data()[i] == Approx(expected[i]).margin(1e-6));
+        }
+    }
+}
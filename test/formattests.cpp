@@ -0,0 +1,136 @@
+#include "catch.hpp"
+#include "../src/format.h"
+#include "../src/parse.h"
+#include <cmath>
+#include <random>
+#include <string>
+
+using namespace unitized;
+
+namespace {
+
+template <class T>
+std::string format(T value, FormatStyle style = FormatStyle::Shortest, int precision = 0) {
+    char buf[64];
+    std::to_chars_result result = format_to(buf, sizeof(buf), value, style, precision);
+    CHECK(result.ec == std::errc());
+    return std::string(buf, result.ptr);
+}
+
+} // namespace
+
+TEST_CASE( "Format lengths" , "[unitized, format]" ) {
+    SECTION( "shortest" ) {
+        CHECK(format(Length::feet(12.5)) == "12.5ft");
+        CHECK(format(Length::meters(0.1)) == "0.1m");
+        CHECK(format(Length::centimeters(-3)) == "-3cm");
+        CHECK(format(Length::kilometers(1e21)) == "1e+21km");
+        CHECK(format(Length::yards(2)) == "2yd");
+        CHECK(format(Length::inches(7)) == "7in");
+        CHECK(format(Length::miles(1.0 / 3)) == "0.3333333333333333mi");
+        CHECK(format(Length::meters(INFINITY)) == "infm");
+    }
+    SECTION( "fixed" ) {
+        CHECK(format(Length::feet(12.5), FormatStyle::Fixed, 2) == "12.50ft");
+        CHECK(format(Length::meters(2.675), FormatStyle::Fixed, 2) == "2.67m");
+        CHECK(format(Length::meters(-0.4), FormatStyle::Fixed, 0) == "-0m");
+    }
+    SECTION( "feet and inches" ) {
+        CHECK(format(Length::feet(5.25), FormatStyle::FeetInches) == "5'3\"");
+        CHECK(format(Length::feet(5.25), FormatStyle::FeetInches, 2) == "5'3.00\"");
+        CHECK(format(Length::inches(-70.25), FormatStyle::FeetInches, 1) == "-5'10.3\"");
+        CHECK(format(Length::meters(1), FormatStyle::FeetInches, 3) == "3'3.370\"");
+        CHECK(format(Length::inches(2), FormatStyle::FeetInches) == "0'2\"");
+        // rounding carries into the feet
+        CHECK(format(Length::inches(23.96), FormatStyle::FeetInches, 1) == "2'0.0\"");
+        CHECK(format(Length::meters(1e308), FormatStyle::FeetInches) == "1e+308m");
+        CHECK(format(Length::feet(NAN), FormatStyle::FeetInches) == "nanft");
+    }
+    SECTION( "errors" ) {
+        char buf[8];
+        std::to_chars_result result = format_to(buf, 4, Length::feet(12.5));
+        CHECK(result.ec == std::errc::value_too_large);
+        CHECK(result.ptr == buf + 4);
+        CHECK(format_to(buf, 5, Length::feet(12.5)).ec == std::errc::value_too_large);
+        CHECK(format_to(buf, 6, Length::feet(12.5)).ptr == buf + 6);
+        CHECK(format_to(buf, 3, Length::feet(5.25), FormatStyle::FeetInches).ec == std::errc::value_too_large);
+        CHECK(format_to(buf, 5, Length::feet(5.25), FormatStyle::FeetInches).ptr == buf + 4);
+
+        result = format_to(buf, sizeof(buf), Length::feet(1), FormatStyle::DegreesMinutesSeconds);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == buf);
+        CHECK(format_to(buf, sizeof(buf), Length::feet(1), FormatStyle::Fixed, -1).ec == std::errc::invalid_argument);
+        CHECK(format_to(buf, sizeof(buf), Length::feet(1), FormatStyle::FeetInches, 10).ec == std::errc::invalid_argument);
+    }
+    SECTION( "round trips through parse" ) {
+        std::mt19937_64 random(42);
+        std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+        for (int i = 0; i < 1000; i++) {
+            Length length(distribution(random), static_cast<Length::Unit>(1 + i % Length::Miles));
+            std::string text = format(length);
+            Length parsed = Length::meters(0);
+            ParseResult result = parse(text, parsed);
+            INFO(text);
+            CHECK(result.ptr == text.data() + text.size());
+            CHECK(parsed.unit == length.unit);
+            CHECK(parsed.convertTo(length.unit) == length.convertTo(length.unit));
+
+            text = format(length, FormatStyle::FeetInches, 4);
+            result = parse(text, parsed);
+            CHECK(result.ptr == text.data() + text.size());
+            CHECK(parsed.toInches() == Approx(length.toInches()).margin(0.00005));
+        }
+    }
+}
+
+TEST_CASE( "Format angles" , "[unitized, format]" ) {
+    SECTION( "shortest" ) {
+        CHECK(format(Angle::degrees(45)) == "45deg");
+        CHECK(format(Angle::gradians(100.5)) == "100.5grad");
+        CHECK(format(Angle::radians(1.2)) == "1.2rad");
+        CHECK(format(Angle::milsNATO(1600)) == "1600mil");
+        CHECK(format(Angle::percentGrade(-12)) == "-12%");
+    }
+    SECTION( "fixed" ) {
+        CHECK(format(Angle::degrees(45), FormatStyle::Fixed, 3) == "45.000deg");
+        CHECK(format(Angle::radians(-1.23456), FormatStyle::Fixed, 2) == "-1.23rad");
+    }
+    SECTION( "degrees, minutes and seconds" ) {
+        CHECK(format(Angle::degrees(45 + 30.0 / 60 + 15.0 / 3600), FormatStyle::DegreesMinutesSeconds) ==
+              "45\xc2\xb0" "30'15\"");
+        CHECK(format(Angle::degrees(45 + 5.0 / 60 + 3.25 / 3600), FormatStyle::DegreesMinutesSeconds, 2) ==
+              "45\xc2\xb0" "05'03.25\"");
+        CHECK(format(Angle::degrees(-12.5), FormatStyle::DegreesMinutesSeconds) == "-12\xc2\xb0" "30'00\"");
+        CHECK(format(Angle::gradians(100), FormatStyle::DegreesMinutesSeconds) == "90\xc2\xb0" "00'00\"");
+        // rounding carries into the minutes and degrees
+        CHECK(format(Angle::degrees(9.99999), FormatStyle::DegreesMinutesSeconds, 1) == "10\xc2\xb0" "00'00.0\"");
+        CHECK(format(Angle::degrees(INFINITY), FormatStyle::DegreesMinutesSeconds) == "infdeg");
+    }
+    SECTION( "errors" ) {
+        char buf[16];
+        CHECK(format_to(buf, sizeof(buf), Angle::degrees(1), FormatStyle::FeetInches).ec ==
+              std::errc::invalid_argument);
+        CHECK(format_to(buf, 9, Angle::degrees(12.5), FormatStyle::DegreesMinutesSeconds).ec ==
+              std::errc::value_too_large);
+        CHECK(format_to(buf, 10, Angle::degrees(12.5), FormatStyle::DegreesMinutesSeconds).ptr == buf + 10);
+    }
+    SECTION( "round trips through parse" ) {
+        std::mt19937_64 random(42);
+        std::uniform_real_distribution<double> distribution(-1000, 1000);
+        for (int i = 0; i < 1000; i++) {
+            Angle angle(distribution(random), static_cast<Angle::Unit>(1 + i % Angle::PercentGrade));
+            std::string text = format(angle);
+            Angle parsed = Angle::degrees(0);
+            ParseResult result = parse(text, parsed);
+            INFO(text);
+            CHECK(result.ptr == text.data() + text.size());
+            CHECK(parsed.unit == angle.unit);
+            CHECK(parsed.convertTo(angle.unit) == angle.convertTo(angle.unit));
+
+            text = format(angle, FormatStyle::DegreesMinutesSeconds, 3);
+            result = parse(text, parsed);
+            CHECK(result.ptr == text.data() + text.size());
+            CHECK(parsed.toDegrees() == Approx(angle.toDegrees()).margin(0.0005 / 3600));
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "../src/lengtharray.h"
+
+using namespace unitized;
+
+TEST_CASE( "LengthArray" , "[unitized, length]" ) {
+    LengthArray feet({1, 2, 3, -4}, Length::Feet);
+
+    SECTION("elements") {
+        CHECK(feet.size() == 4);
+        CHECK(feet.unit() == Length::Feet);
+        CHECK(feet[2].equals(Length::feet(3)));
+        feet.set(0, Length::inches(6));
+        CHECK(feet.data()[0] == 0.5);
+        feet.push_back(Length::yards(1));
+        CHECK(feet.size() == 5);
+        CHECK(feet[4].convertTo(Length::Feet) == 3);
+    }
+    SECTION("conversions") {
+        std::vector<double> meters = feet.convertTo(Length::Meters);
+        LengthArray inches = feet.as(Length::Inches);
+        CHECK(inches.unit() == Length::Inches);
+        for (std::size_t i = 0; i < feet.size(); i++) {
+            CHECK(meters[i] == feet[i].toMeters());
+            CHECK(inches.data()[i] == feet[i].toInches());
+        }
+        CHECK(inches.equals(feet));
+        CHECK(!feet.equals(feet.mul(2)));
+        CHECK(!feet.equals(LengthArray(Length::Feet)));
+    }
+    SECTION("arithmetic") {
+        LengthArray inches({12, 12, 12, 12}, Length::Inches);
+        LengthArray sum = feet.add(inches);
+        LengthArray difference = feet.sub(inches);
+        LengthArray product = feet.mul(3);
+        LengthArray quotient = feet.div(2);
+        for (std::size_t i = 0; i < feet.size(); i++) {
+            CHECK(sum[i].equals(feet[i].add(inches[i])));
+            CHECK(difference[i].equals(feet[i].sub(inches[i])));
+            CHECK(product[i].equals(feet[i].mul(3)));
+            CHECK(quotient[i].equals(feet[i].div(2)));
+        }
+        CHECK(sum.unit() == Length::Feet);
+    }
+    SECTION("comparison") {
+        std::vector<int> result = feet.compareTo(LengthArray({24, 24, 24, 24}, Length::Inches));
+        CHECK(result == std::vector<int>({-1, 0, 1, -1}));
+    }
+}
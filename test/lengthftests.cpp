@@ -0,0 +1,60 @@
+#include "catch.hpp"
+#include "../src/lengthf.h"
+#include <cmath>
+#include <vector>
+
+using namespace unitized;
+
+TEST_CASE( "LengthF" , "[unitized, lengthf]" ) {
+    SECTION( "narrowing and widening" ) {
+        LengthF length(Length::feet(10.25));
+        CHECK(length.unit == Length::Feet);
+        CHECK(length.convertTo(Length::Feet) == 10.25f);
+        Length wide = length;
+        CHECK(wide.equals(Length::feet(10.25)));
+
+        LengthF rounded(Length::meters(0.1));
+        CHECK(Length(rounded).toMeters() == static_cast<double>(0.1f));
+
+        LengthF result = LengthF::meters(0);
+        CHECK(LengthF::narrow(Length::miles(3), result));
+        CHECK(result.equals(LengthF::miles(3)));
+        CHECK_FALSE(LengthF::narrow(Length::meters(1e39), result));
+        CHECK(result.isInfinite());
+        CHECK_FALSE(LengthF::narrow(Length::meters(1e-50), result));
+        CHECK(result.isZero());
+        CHECK(LengthF::narrow(Length::meters(INFINITY), result));
+        CHECK(LengthF::narrow(Length::meters(NAN), result));
+        CHECK(result.isNaN());
+    }
+    SECTION( "arithmetic" ) {
+        LengthF sum = LengthF::feet(1).add(LengthF::inches(6));
+        CHECK(sum.unit == Length::Feet);
+        CHECK(sum.convertTo(Length::Feet) == 1.5f);
+        CHECK(sum.as(Length::Inches).equals(LengthF::inches(18)));
+        CHECK(sum.sub(LengthF::yards(1)).negate().convertTo(Length::Feet) == 1.5f);
+        CHECK(sum.mul(2).div(3).convertTo(Length::Feet) == 1);
+        CHECK(sum.divUnitless(LengthF::inches(6)) == 3);
+        CHECK(LengthF::meters(-7).mod(LengthF::meters(2)).abs().equals(LengthF::meters(1)));
+        CHECK(LengthF::kilometers(1).compareTo(LengthF::meters(999)) > 0);
+        CHECK(LengthF::centimeters(1).compareTo(LengthF::inches(1)) < 0);
+        CHECK(sizeof(LengthF) == 8);
+    }
+    SECTION( "converter" ) {
+        LengthF::Converter feetToMeters(Length::Feet, Length::Meters);
+        std::vector<float> in = {0, 1, 2.5f, -3, 1e6f};
+        std::vector<float> out(in.size());
+        feetToMeters.apply(in.data(), out.data(), in.size());
+        for (std::size_t i = 0; i < in.size(); i++) {
+            CHECK(out[i] == Approx(in[i] * 0.3048).epsilon(1e-7));
+        }
+        std::vector<double> wide = {1, 10, 1e-3};
+        CHECK(feetToMeters.narrow(wide.data(), out.data(), wide.size()));
+        CHECK(out[1] == static_cast<float>(10 * 0.3048));
+        std::vector<double> back(wide.size());
+        LengthF::Converter(Length::Meters, Length::Feet).widen(out.data(), back.data(), wide.size());
+        CHECK(back[1] == Approx(10).epsilon(1e-7));
+        wide[2] = 1e300;
+        CHECK_FALSE(feetToMeters.narrow(wide.data(), out.data(), wide.size()));
+    }
+}
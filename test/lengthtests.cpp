@@ -1,6 +1,10 @@
 #include "catch.hpp"
 #include "../src/length.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <initializer_list>
+#include <vector>
 
 using namespace unitized;
 
@@ -18,6 +22,32 @@ void checkConversions(std::initializer_list<Length> values, double epsilon) {
     }
 }
 
+// The conversions Length made before its factor matrix, through meters.
+double oldToMeters(double value, Length::Unit from) {
+    switch (from) {
+    case Length::Meters: return value;
+    case Length::Centimeters: return value * 0.01;
+    case Length::Kilometers: return value * 1000;
+    case Length::Feet: return value * 0.3048;
+    case Length::Miles: return value * 5280 * 0.3048;
+    case Length::Yards: return value * 3 * 0.3048;
+    case Length::Inches: return value * 0.3048 / 12;
+    }
+    return NAN;
+}
+double oldFromMeters(double value, Length::Unit to) {
+    switch (to) {
+    case Length::Meters: return value;
+    case Length::Centimeters: return value * 100;
+    case Length::Kilometers: return value * 0.001;
+    case Length::Feet: return value / 0.3048;
+    case Length::Miles: return value / (5280 * 0.3048);
+    case Length::Yards: return value / (3 * 0.3048);
+    case Length::Inches: return value * 12 / 0.3048;
+    }
+    return NAN;
+}
+
 TEST_CASE( "Length" , "[unitized, length]" ) {
     SECTION("imperial conversions") {
         checkConversions({
@@ -44,4 +74,85 @@ TEST_CASE( "Length" , "[unitized, length]" ) {
                              Length::inches(12)
                          }, 1e-8);
     }
+    SECTION( "factor matrix" ) {
+        for (int from = Length::Meters; from <= Length::Miles; from++) {
+            for (int to = Length::Meters; to <= Length::Miles; to++) {
+                INFO(from << " to " << to);
+                for (double value : {1.0, -2.5, 1234.5}) {
+                    double expected = oldFromMeters(oldToMeters(value, Length::Unit(from)), Length::Unit(to));
+                    CHECK(Length(value, Length::Unit(from)).convertTo(Length::Unit(to)) ==
+                          Approx(expected).epsilon(1e-15));
+                }
+            }
+        }
+    }
+    SECTION( "invalid units" ) {
+        CHECK(std::isnan(Length(5, Length::parseUnit("bogus")).toMeters()));
+        CHECK(std::isnan(Length::meters(5).convertTo(Length::Unit(0))));
+        CHECK(std::isnan(Length::meters(5).convertTo(Length::Unit(42))));
+        CHECK(std::isnan(Length(5, Length::Unit(0)).convertTo(Length::Unit(0))));
+        CHECK(std::isnan(Length::Converter(Length::Unit(0), Length::Meters)(1)));
+        CHECK(std::isnan(Length::Converter(Length::Feet, Length::Unit(-1))(1)));
+    }
+    SECTION( "converter" ) {
+        Length::Converter feetToMeters(Length::Feet, Length::Meters);
+        CHECK(feetToMeters(10) == Length::feet(10).toMeters());
+
+        double in[] = {0, 1, 2.5, -3, 1e6};
+        double out[5];
+        feetToMeters.apply(in, out, 5);
+        for (int i = 0; i < 5; i++) {
+            CHECK(out[i] == Length::feet(in[i]).toMeters());
+        }
+        Length::Converter(Length::Yards, Length::Inches).apply(in, in, 5);
+        CHECK(in[3] == -108);
+    }
+    SECTION( "assignment" ) {
+        Length length = Length::feet(1);
+        length = Length::meters(2);
+        CHECK(length.unit == Length::Meters);
+        CHECK(length.toMeters() == 2);
+
+        std::vector<Length> lengths = {Length::feet(4), Length::meters(1), Length::inches(13), Length::yards(1)};
+        std::sort(lengths.begin(), lengths.end(), [](Length a, Length b) { return a.compareTo(b) < 0; });
+        CHECK(lengths[0].equals(Length::feet(1).add(Length::inches(1))));
+        CHECK(lengths[1].unit == Length::Yards);
+        CHECK(lengths[2].unit == Length::Meters);
+        CHECK(lengths[3].unit == Length::Feet);
+        lengths.erase(lengths.begin());
+        CHECK(lengths.front().unit == Length::Yards);
+
+        Length copy = Length::meters(0);
+        std::memcpy(&copy, &lengths.back(), sizeof(Length));
+        CHECK(copy.unit == Length::Feet);
+        CHECK(copy.equals(Length::feet(4)));
+    }
+    SECTION( "unit names" ) {
+        CHECK(Length::parseUnit("ft") == Length::Feet);
+        CHECK(Length::parseUnit("FT") == Length::Feet);
+        CHECK(Length::parseUnit("feet") == Length::Feet);
+        CHECK(Length::parseUnit("'") == Length::Feet);
+        CHECK(Length::parseUnit("m") == Length::Meters);
+        CHECK(Length::parseUnit("Metres") == Length::Meters);
+        CHECK(Length::parseUnit("centimeters") == Length::Centimeters);
+        CHECK(Length::parseUnit("KM") == Length::Kilometers);
+        CHECK(Length::parseUnit("yds") == Length::Yards);
+        CHECK(Length::parseUnit("\"") == Length::Inches);
+        CHECK(Length::parseUnit("mi") == Length::Miles);
+
+        CHECK(Length::parseUnit("") == 0);
+        CHECK(Length::parseUnit("fe") == 0);
+        CHECK(Length::parseUnit("feets") == 0);
+        CHECK(Length::parseUnit("deg") == 0);
+        CHECK(Length::parseUnit(std::string_view("ft\0", 3)) == 0);
+    }
+
+#ifdef UNITIZED_HEADER_ONLY
+    SECTION( "constant expressions" ) {
+        static_assert(Length::feet(6).convertTo(Length::Yards) == 2, "feet to yards");
+        static_assert(Length::kilometers(1).add(Length::meters(500)).toMeters() == 1500, "add");
+        static_assert(Length::inches(3).compareTo(Length::feet(1)) < 0, "compareTo");
+        static_assert(Length::parseUnit("Yards") == Length::Yards, "parseUnit");
+    }
+#endif
 }
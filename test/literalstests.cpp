@@ -0,0 +1,34 @@
+#include "catch.hpp"
+#include "../src/literals.h"
+
+using namespace unitized::literals;
+using unitized::Angle;
+using unitized::Length;
+using unitized::LengthIn;
+
+// Literal arithmetic is a constant expression in every build.
+static_assert((10_ft + 3_in).count() == 10.25, "");
+static_assert((1_km - 500_m).count() == 0.5, "");
+static_assert((2_yd).count() == 2, "");
+static_assert(LengthIn<Length::Feet>(1_mi).count() == 5280, "");
+static_assert(std::is_same<decltype(12.5_ft), LengthIn<Length::Feet>>::value, "");
+static_assert((90_deg) == (100_grad), "");
+static_assert((1600_mil) == (90_deg), "");
+
+TEST_CASE( "Literals" , "[unitized, literals]" ) {
+    Length length = 10_ft + 3_in;
+    CHECK(length.unit == Length::Feet);
+    CHECK(length.equals(Length::inches(123)));
+    CHECK(Length(2.5_cm).toMeters() == 0.025);
+    CHECK(Length(1_m).equals(Length::meters(1)));
+    CHECK(Length(3_km).equals(Length::kilometers(3)));
+    CHECK(Length(1_mi).equals(Length::feet(5280)));
+    CHECK(Angle::sin(45.0_deg) == Approx(0.7071067811865476));
+    CHECK(Angle(1_rad).toDegrees() == Approx(57.29577951308232));
+    CHECK(Angle(400_grad).equals(Angle::degrees(360)));
+    CHECK(Angle(3200_mil).equals(Angle::degrees(180)));
+    Angle grade = 100_pct;
+    CHECK(grade.unit == Angle::PercentGrade);
+    CHECK(grade.toDegrees() == Approx(45));
+    CHECK(Angle(12.5_pct).equals(Angle::percentGrade(12.5)));
+}
@@ -0,0 +1,43 @@
+#include "catch.hpp"
+#include "../src/mappedfile.h"
+#include <cstdio>
+#include <string>
+#include <utility>
+
+using namespace unitized;
+
+TEST_CASE( "MappedFile" , "[unitized, mappedfile]" ) {
+    const char* path = "unitized-mappedfile-test.txt";
+    std::string contents = "12.5,45\n3,90\n";
+    std::FILE* file = std::fopen(path, "wb");
+    REQUIRE(file);
+    std::fwrite(contents.data(), 1, contents.size(), file);
+    std::fclose(file);
+
+    MappedFile mapped;
+    CHECK(!mapped.isOpen());
+    CHECK(mapped.text().empty());
+    REQUIRE(mapped.open(path));
+    CHECK(mapped.isOpen());
+    CHECK(mapped.text() == contents);
+
+    MappedFile moved(std::move(mapped));
+    CHECK(!mapped.isOpen());
+    CHECK(moved.text() == contents);
+    mapped = std::move(moved);
+    CHECK(mapped.text() == contents);
+
+    mapped.close();
+    CHECK(!mapped.isOpen());
+    CHECK(mapped.text().empty());
+
+    // empty files can't be mapped, but open as empty text
+    file = std::fopen(path, "wb");
+    std::fclose(file);
+    CHECK(mapped.open(path));
+    CHECK(mapped.text().empty());
+    mapped.close();
+
+    std::remove(path);
+    CHECK(!mapped.open(path));
+}
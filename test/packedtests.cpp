@@ -0,0 +1,63 @@
+#include "catch.hpp"
+#include "../src/packed.h"
+#include <cmath>
+#include <limits>
+
+using namespace unitized;
+
+TEST_CASE( "Packed" , "[unitized, packed]" ) {
+    SECTION( "exact values" ) {
+        for (int u = Length::Meters; u <= Length::Miles; u++) {
+            Length::Unit unit = static_cast<Length::Unit>(u);
+            for (double value : {0.0, -0.0, 1.0, -10.25, 5280.0, 1e15}) {
+                PackedLength packed(Length(value, unit));
+                CHECK(packed.unit() == unit);
+                CHECK(packed.value() == value);
+                CHECK(std::signbit(packed.value()) == std::signbit(value));
+                Length length = packed;
+                CHECK(length.unit == unit);
+                CHECK(length.equals(Length(value, unit)));
+            }
+        }
+        for (int u = Angle::Degrees; u <= Angle::PercentGrade; u++) {
+            Angle::Unit unit = static_cast<Angle::Unit>(u);
+            PackedAngle packed(Angle(-359.5, unit));
+            CHECK(packed.unit() == unit);
+            CHECK(packed.get().equals(Angle(-359.5, unit)));
+        }
+    }
+    SECTION( "rounding" ) {
+        for (double value : {0.1, -0.3048, 1.0 / 3, 3.14159265358979, 6.02e23, -1e-300}) {
+            double packed = PackedLength(value, Length::Feet).value();
+            CHECK(std::fabs(packed - value) <= std::fabs(value) * std::ldexp(1, -50));
+        }
+        // subnormals round to a multiple of 8 of the smallest
+        CHECK(PackedLength(std::ldexp(13, -1074), Length::Feet).value() == std::ldexp(16, -1074));
+        // the largest double rounds down instead of overflowing
+        double max = std::numeric_limits<double>::max();
+        CHECK(PackedAngle(max, Angle::Radians).value() < max);
+        CHECK(PackedAngle(max, Angle::Radians).value() > max * (1 - std::ldexp(1, -49)));
+        CHECK(PackedAngle(-max, Angle::Radians).value() < 0);
+    }
+    SECTION( "special values" ) {
+        double infinity = std::numeric_limits<double>::infinity();
+        CHECK(PackedLength(infinity, Length::Miles).value() == infinity);
+        CHECK(PackedLength(-infinity, Length::Inches).value() == -infinity);
+        CHECK(PackedLength(-infinity, Length::Inches).unit() == Length::Inches);
+        CHECK(std::isnan(PackedLength(NAN, Length::Yards).value()));
+        CHECK(std::isnan(PackedLength(std::numeric_limits<double>::signaling_NaN(), Length::Yards).value()));
+        CHECK(PackedLength(NAN, Length::Yards).unit() == Length::Yards);
+    }
+    SECTION( "in structs" ) {
+        struct Shot {
+            PackedLength distance;
+            PackedAngle azimuth;
+            PackedAngle inclination;
+        };
+        static_assert(sizeof(Shot) == 24, "three packed values");
+        Shot shot = {PackedLength(Length::feet(25.5)), PackedAngle(Angle::degrees(270)), PackedAngle(Angle::percentGrade(-12))};
+        CHECK(Length(shot.distance).toFeet() == 25.5);
+        CHECK(Angle(shot.azimuth).toDegrees() == 270);
+        CHECK(Angle(shot.inclination).unit == Angle::PercentGrade);
+    }
+}
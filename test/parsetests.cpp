@@ -0,0 +1,139 @@
+#include "catch.hpp"
+#include "../src/parse.h"
+#include <cmath>
+#include <string_view>
+
+using namespace unitized;
+
+namespace {
+
+// Parses all of text, or fails the check.
+Length parseLength(std::string_view text, Length::Unit defaultUnit = Length::Meters) {
+    Length length = Length::meters(NAN);
+    ParseResult result = parse(text, length, defaultUnit);
+    INFO(text);
+    CHECK(result.error == ParseError::None);
+    CHECK(result.ptr == text.data() + text.size());
+    return length;
+}
+
+Angle parseAngle(std::string_view text, Angle::Unit defaultUnit = Angle::Degrees) {
+    Angle angle = Angle::degrees(NAN);
+    ParseResult result = parse(text, angle, defaultUnit);
+    INFO(text);
+    CHECK(result.error == ParseError::None);
+    CHECK(result.ptr == text.data() + text.size());
+    return angle;
+}
+
+} // namespace
+
+TEST_CASE( "Parse lengths" , "[unitized, parse]" ) {
+    SECTION( "units" ) {
+        Length length = parseLength("12.5ft");
+        CHECK(length.unit == Length::Feet);
+        CHECK(length.toFeet() == 12.5);
+        CHECK(parseLength("12.5 feet").equals(Length::feet(12.5)));
+        CHECK(parseLength("-3m").equals(Length::meters(-3)));
+        CHECK(parseLength("+1e3 KM").equals(Length::kilometers(1000)));
+        CHECK(parseLength("2 Metres").equals(Length::meters(2)));
+        CHECK(parseLength("7cm").unit == Length::Centimeters);
+        CHECK(parseLength("3yd").unit == Length::Yards);
+        CHECK(parseLength("4 inches").unit == Length::Inches);
+        CHECK(parseLength(".5mi").equals(Length::miles(0.5)));
+        CHECK(parseLength("42").equals(Length::meters(42)));
+        CHECK(parseLength("42", Length::Feet).equals(Length::feet(42)));
+    }
+    SECTION( "compound" ) {
+        Length length = parseLength("3m 20cm");
+        CHECK(length.unit == Length::Meters);
+        CHECK(length.toMeters() == Approx(3.2));
+        CHECK(parseLength("5ft 3in").toFeet() == 5.25);
+        CHECK(parseLength("5' 3\"").toFeet() == 5.25);
+        CHECK(parseLength("5'3").toFeet() == 5.25);
+        CHECK(parseLength("-5'6\"").toFeet() == -5.5);
+        CHECK(parseLength("1mi 10ft 6in").toFeet() == Approx(5290.5));
+    }
+    SECTION( "partial input" ) {
+        std::string_view text = "12.5ft,north";
+        Length length = Length::meters(0);
+        ParseResult result = parse(text, length);
+        CHECK(result);
+        CHECK(*result.ptr == ',');
+        CHECK(length.equals(Length::feet(12.5)));
+
+        // a bare number after meters isn't part of the value
+        text = "3m 20";
+        result = parse(text, length);
+        CHECK(result.ptr == text.data() + 2);
+        CHECK(length.equals(Length::meters(3)));
+
+        // spaces after a unitless number aren't consumed
+        text = "7 ";
+        result = parse(text, length);
+        CHECK(result.ptr == text.data() + 1);
+    }
+    SECTION( "errors" ) {
+        Length length = Length::meters(1);
+        std::string_view text = "ft";
+        ParseResult result = parse(text, length);
+        CHECK(result.error == ParseError::InvalidNumber);
+        CHECK(result.ptr == text.data());
+        CHECK_FALSE(result);
+        CHECK(length.equals(Length::meters(1)));
+
+        CHECK(parse("", length).error == ParseError::InvalidNumber);
+        CHECK(parse("-", length).error == ParseError::InvalidNumber);
+        CHECK(parse(".", length).error == ParseError::InvalidNumber);
+        CHECK(parse("--3", length).error == ParseError::InvalidNumber);
+
+        text = "12 furlongs";
+        result = parse(text, length);
+        CHECK(result.error == ParseError::UnknownUnit);
+        CHECK(result.ptr == text.data() + 3);
+
+        CHECK(parse("1e400m", length).error == ParseError::OutOfRange);
+        CHECK(length.equals(Length::meters(1)));
+    }
+}
+
+TEST_CASE( "Parse angles" , "[unitized, parse]" ) {
+    SECTION( "units" ) {
+        CHECK(parseAngle("45deg").equals(Angle::degrees(45)));
+        CHECK(parseAngle("45\xc2\xb0").unit == Angle::Degrees);
+        CHECK(parseAngle("100 grad").equals(Angle::gradians(100)));
+        CHECK(parseAngle("100gon").unit == Angle::Gradians);
+        CHECK(parseAngle("1.2rad").equals(Angle::radians(1.2)));
+        CHECK(parseAngle("1600 mils").equals(Angle::milsNATO(1600)));
+        CHECK(parseAngle("-12%").equals(Angle::percentGrade(-12)));
+        CHECK(parseAngle("270").equals(Angle::degrees(270)));
+        CHECK(parseAngle("3", Angle::Radians).equals(Angle::radians(3)));
+    }
+    SECTION( "degrees, minutes and seconds" ) {
+        Angle angle = parseAngle("45\xc2\xb0" "30'15\"");
+        CHECK(angle.unit == Angle::Degrees);
+        CHECK(angle.toDegrees() == Approx(45 + 30 / 60.0 + 15 / 3600.0));
+        CHECK(parseAngle("45\xc2\xb0" "30.5'").toDegrees() == Approx(45 + 30.5 / 60));
+        CHECK(parseAngle("-12d 30'").toDegrees() == -12.5);
+        CHECK(parseAngle("10deg 15\"").toDegrees() == Approx(10 + 15 / 3600.0));
+        CHECK(parseAngle("1\xc2\xb0" "2\xe2\x80\xb2" "3\xe2\x80\xb3").toDegrees() == Approx(1 + 2 / 60.0 + 3 / 3600.0));
+    }
+    SECTION( "errors" ) {
+        Angle angle = Angle::degrees(1);
+        std::string_view text = "45\xc2\xb0" "60'";
+        ParseResult result = parse(text, angle);
+        CHECK(result.error == ParseError::OutOfRange);
+        CHECK(result.ptr == text.data() + 4);
+        CHECK(parse("45d 30' 75\"", angle).error == ParseError::OutOfRange);
+        CHECK(parse("45 cubits", angle).error == ParseError::UnknownUnit);
+        CHECK(parse("north", angle).error == ParseError::InvalidNumber);
+        CHECK(angle.equals(Angle::degrees(1)));
+
+        // minutes without a sign end the value after the degrees
+        text = "45\xc2\xb0 30";
+        result = parse(text, angle);
+        CHECK(result);
+        CHECK(result.ptr == text.data() + 4);
+        CHECK(angle.equals(Angle::degrees(45)));
+    }
+}
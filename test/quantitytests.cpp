@@ -0,0 +1,100 @@
+#include "catch.hpp"
+#include "../src/quantity.h"
+#include <type_traits>
+
+using namespace unitized;
+
+// The unit lives in the type, so a Quantity is exactly its Rep.
+static_assert(sizeof(LengthIn<Length::Feet>) == sizeof(double), "no per-value unit");
+static_assert(sizeof(AngleIn<Angle::Degrees, float>) == sizeof(float), "no per-value unit");
+static_assert(std::is_trivially_copyable<LengthIn<Length::Feet>>::value, "passed in registers");
+
+// Conversions between units fold at compile time.
+static_assert(LengthIn<Length::Inches>(LengthIn<Length::Feet>(2)).count() == 24, "");
+static_assert((LengthIn<Length::Feet>(10) + LengthIn<Length::Inches>(6)).count() == 10.5, "");
+static_assert(LengthIn<Length::Yards>(1) == LengthIn<Length::Feet>(3), "");
+static_assert(AngleIn<Angle::Gradians>(AngleIn<Angle::Degrees>(90)).count() == 100, "");
+static_assert(LengthIn<Length::Meters>(6) / LengthIn<Length::Meters>(4) == 1.5, "");
+
+// Lengths multiply into areas and volumes, and only matching dimensions add.
+template <class A, class B, class = void>
+struct CanAdd: std::false_type {};
+template <class A, class B>
+struct CanAdd<A, B, decltype(void(std::declval<A>() + std::declval<B>()))>: std::true_type {};
+template <class A, class B, class = void>
+struct CanMultiply: std::false_type {};
+template <class A, class B>
+struct CanMultiply<A, B, decltype(void(std::declval<A>() * std::declval<B>()))>: std::true_type {};
+
+typedef LengthIn<Length::Feet> Feet;
+typedef AreaIn<AreaDimension::SquareFeet> SquareFeet;
+static_assert(std::is_same<decltype(Feet(2) * Feet(3)), SquareFeet>::value, "");
+static_assert(std::is_same<decltype(Feet(2) * SquareFeet(3)), VolumeIn<VolumeDimension::CubicFeet>>::value, "");
+static_assert(std::is_same<decltype(SquareFeet(6) / Feet(3)), Feet>::value, "");
+static_assert((Feet(2) * Feet(3)).count() == 6, "");
+static_assert(AreaIn<AreaDimension::SquareInches>(SquareFeet(1)).count() == 144, "");
+static_assert(VolumeIn<VolumeDimension::CubicFeet>(VolumeIn<VolumeDimension::CubicYards>(1)).count() == 27, "");
+static_assert(CanAdd<SquareFeet, AreaIn<AreaDimension::SquareMeters>>::value, "");
+static_assert(!CanAdd<SquareFeet, Feet>::value, "an area plus a length");
+static_assert(!CanAdd<Feet, AngleIn<Angle::Degrees>>::value, "a length plus an angle");
+static_assert(!CanMultiply<Feet, AngleIn<Angle::Degrees>>::value, "no length-angle dimension");
+static_assert(!CanMultiply<SquareFeet, SquareFeet>::value, "no fourth power of length");
+static_assert(!std::is_convertible<SquareFeet, Length>::value, "areas have no runtime class");
+
+TEST_CASE( "Quantity" , "[unitized, quantity]" ) {
+    SECTION("arithmetic") {
+        LengthIn<Length::Feet> a(3), b(4.5);
+        CHECK((a + b).count() == 7.5);
+        CHECK((a - b).count() == -1.5);
+        CHECK((a * 2).count() == 6);
+        CHECK((2 * a).count() == 6);
+        CHECK((b / 3).count() == 1.5);
+        CHECK(b / a == 1.5);
+        CHECK((-a).count() == -3);
+        a += b;
+        a -= LengthIn<Length::Feet>(0.5);
+        a *= 2;
+        a /= 4;
+        CHECK(a.count() == 3.5);
+        CHECK(a < b);
+        CHECK(a != b);
+        CHECK(LengthIn<Length::Meters>() == LengthIn<Length::Meters>(0));
+    }
+    SECTION("mixed units") {
+        LengthIn<Length::Meters> meters(1);
+        LengthIn<Length::Centimeters> centimeters(50);
+        CHECK((meters + centimeters).count() == 1.5);
+        CHECK((meters - centimeters).count() == 0.5);
+        CHECK(meters > centimeters);
+        CHECK(centimeters / meters == 0.5);
+        LengthIn<Length::Feet> feet = meters;
+        CHECK(feet.count() == Approx(1 / 0.3048));
+        LengthIn<Length::Feet, float> narrow = LengthIn<Length::Yards>(2);
+        CHECK(narrow.count() == 6.0f);
+    }
+    SECTION("runtime conversions") {
+        Length length = LengthIn<Length::Feet>(12);
+        CHECK(length.unit == Length::Feet);
+        CHECK(length.equals(Length::feet(12)));
+        LengthIn<Length::Inches> inches(Length::yards(1));
+        CHECK(inches.count() == 36);
+        Angle angle = AngleIn<Angle::MilsNATO>(1600);
+        CHECK(angle.equals(Angle::degrees(90)));
+        CHECK(Angle::sin(AngleIn<Angle::Degrees>(90)) == 1);
+        AngleIn<Angle::Radians> radians(Angle::percentGrade(100));
+        CHECK(radians.count() == Approx(0.7853981633974483));
+    }
+    SECTION("areas and volumes") {
+        // a passage cross-section times its length
+        LengthIn<Length::Meters> width(2), height(1.5);
+        AreaIn<AreaDimension::SquareMeters> section = width * height;
+        CHECK(section.count() == 3);
+        VolumeIn<VolumeDimension::CubicMeters> volume = section * LengthIn<Length::Feet>(10);
+        CHECK(volume.count() == Approx(9.144));
+        VolumeIn<VolumeDimension::CubicFeet> cubicFeet = volume;
+        CHECK(cubicFeet.count() == Approx(9.144 / (0.3048 * 0.3048 * 0.3048)));
+        CHECK((volume / height).count() == Approx(6.096));
+        CHECK((volume / section).count() == Approx(3.048));
+        CHECK(AreaIn<AreaDimension::SquareMeters>(1) > AreaIn<AreaDimension::SquareFeet>(10));
+    }
+}
@@ -0,0 +1,402 @@
+#include "catch.hpp"
+#include "../src/simd.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace unitized;
+
+// Runs check against the kernels of every instruction set this host supports.
+template <class Check>
+void forEachIsa(Check check) {
+    for (simd::Isa isa : {simd::Scalar, simd::SSE2, simd::AVX2, simd::AVX512}) {
+        if (simd::isSupported(isa)) {
+            INFO("isa " << isa);
+            check(simd::kernels(isa));
+        }
+    }
+}
+
+// Error of actual in units in the last place of the (rounded) exact result.
+double ulps(double actual, long double exact) {
+    if (std::isnan(actual) && std::isnan(exact)) return 0;
+    double rounded = static_cast<double>(exact);
+    double ulp = std::nextafter(std::fabs(rounded), INFINITY) - std::fabs(rounded);
+    return static_cast<double>(std::fabs(actual - exact) / ulp);
+}
+
+// Checks a kernel against a long double reference on random inputs in
+// [lo, hi], plus the given special values.
+template <class Kernel, class Reference>
+void checkUlps(Kernel kernel, Reference reference, double lo, double hi, double maxUlps,
+               std::initializer_list<double> special = {}) {
+    std::mt19937_64 random(1);
+    std::uniform_real_distribution<double> distribution(lo, hi);
+    std::vector<double> in(special);
+    for (int i = 0; i < 10000; i++) in.push_back(distribution(random));
+    std::vector<double> out(in.size());
+    kernel(in.data(), out.data(), in.size());
+    double worst = 0;
+    for (std::size_t i = 0; i < in.size(); i++) {
+        worst = std::max(worst, ulps(out[i], reference(static_cast<long double>(in[i]))));
+    }
+    CHECK(worst < maxUlps);
+}
+
+TEST_CASE( "SIMD kernels" , "[unitized, simd]" ) {
+    REQUIRE(simd::isSupported(simd::Scalar));
+    CHECK(simd::kernels().isa == simd::detectIsa());
+
+    SECTION("scale") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            // odd sizes exercise the scalar tails
+            for (std::size_t n : {0, 1, 3, 8, 17, 100}) {
+                std::vector<double> in(n), out(n);
+                for (std::size_t i = 0; i < n; i++) in[i] = i * 1.5 - 20;
+                kernels.scale(in.data(), out.data(), n, 0.3048);
+                for (std::size_t i = 0; i < n; i++) {
+                    CHECK(out[i] == in[i] * 0.3048);
+                }
+                std::vector<double> copy = in;
+                kernels.scale(in.data(), in.data(), n, 2);
+                for (std::size_t i = 0; i < n; i++) {
+                    CHECK(in[i] == copy[i] * 2);
+                }
+            }
+        });
+    }
+    SECTION("trigonometry") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            auto sinl = [](long double x) { return std::sin(x); };
+            auto cosl = [](long double x) { return std::cos(x); };
+            auto tanl = [](long double x) { return std::tan(x); };
+            auto asinl = [](long double x) { return std::asin(x); };
+            auto acosl = [](long double x) { return std::acos(x); };
+            auto atanl = [](long double x) { return std::atan(x); };
+            checkUlps(kernels.sin, sinl, -10, 10, 2, {0, -0.0, 1e300, INFINITY, NAN});
+            checkUlps(kernels.sin, sinl, -60000, 60000, 2);
+            checkUlps(kernels.cos, cosl, -10, 10, 2, {0, 1e300, -INFINITY, NAN});
+            checkUlps(kernels.cos, cosl, -60000, 60000, 2);
+            checkUlps(kernels.tan, tanl, -10, 10, 3.5, {0, 1e300});
+            checkUlps(kernels.asin, asinl, -1, 1, 2.5, {-1, 1, 0, 2, NAN});
+            checkUlps(kernels.acos, acosl, -1, 1, 2.5, {-1, 1, 0, -2, NAN});
+            checkUlps(kernels.atan, atanl, -100, 100, 2, {0, 1e300, -INFINITY, NAN});
+            checkUlps(kernels.atan, atanl, -2, 2, 2);
+
+            double y[] = {1, -1, 0, -0.0, 0, 3, INFINITY, NAN, 2.5, -7};
+            double x[] = {1, -1, 0, -1, -0.0, 0, -INFINITY, 1, -1e-300, 4};
+            double out[10];
+            kernels.atan2(y, x, out, 10);
+            for (int i = 0; i < 10; i++) {
+                CHECK(ulps(out[i], std::atan2(static_cast<long double>(y[i]), x[i])) < 2);
+                CHECK(std::signbit(out[i]) == std::signbit(std::atan2(y[i], x[i])));
+            }
+        });
+    }
+    SECTION("sincos") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            std::vector<double> in = {0, -0.0, 0.5, 2, -3, 1e5, 1e300, NAN, 7, -100, 40000};
+            std::vector<double> sin(in.size()), cos(in.size()), expectedSin(in.size()), expectedCos(in.size());
+            kernels.sin(in.data(), expectedSin.data(), in.size());
+            kernels.cos(in.data(), expectedCos.data(), in.size());
+            kernels.sincos(in.data(), sin.data(), cos.data(), in.size());
+            for (std::size_t i = 0; i < in.size(); i++) {
+                CHECK((sin[i] == expectedSin[i] || std::isnan(in[i])));
+                CHECK((cos[i] == expectedCos[i] || std::isnan(in[i])));
+            }
+            // in place, including the lanes that fall back to libm
+            kernels.sincos(in.data(), in.data(), cos.data(), in.size());
+            for (std::size_t i = 0; i < in.size(); i++) {
+                CHECK((in[i] == sin[i] || std::isnan(in[i])));
+            }
+        });
+    }
+    SECTION("native units") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            for (double quarterTurn : {90.0, 100.0, 1600.0}) {
+                // the reference reduces exactly too, since x * pi / 180 in
+                // long double is still far from exact near the zeros
+                long double toRadians = 3.14159265358979323846264338327950288L / 2 / quarterTurn;
+                auto reference = [=](long double x, int shift) {
+                    long double quadrant = std::nearbyint(x / quarterTurn);
+                    long double r = (x - quadrant * quarterTurn) * toRadians;
+                    switch ((static_cast<long long>(quadrant) + shift) & 3) {
+                    case 0: return std::sin(r);
+                    case 1: return std::cos(r);
+                    case 2: return -std::sin(r);
+                    default: return -std::cos(r);
+                    }
+                };
+                checkUlps([&](const double* in, double* out, std::size_t n) { kernels.nativeSin(in, out, n, quarterTurn); },
+                          [&](long double x) { return reference(x, 0); },
+                          -16 * quarterTurn, 16 * quarterTurn, 2);
+                checkUlps([&](const double* in, double* out, std::size_t n) { kernels.nativeCos(in, out, n, quarterTurn); },
+                          [&](long double x) { return reference(x, 1); },
+                          -16 * quarterTurn, 16 * quarterTurn, 2);
+
+                // exact at every multiple of a right angle, and matching the
+                // scalar functions there
+                std::vector<double> in;
+                for (int i = -8; i <= 8; i++) in.push_back(i * quarterTurn);
+                in.push_back(1e300);
+                in.push_back(NAN);
+                std::size_t n = in.size();
+                std::vector<double> sin(n), cos(n), tan(n), sincosSin(n), sincosCos(n);
+                kernels.nativeSin(in.data(), sin.data(), n, quarterTurn);
+                kernels.nativeCos(in.data(), cos.data(), n, quarterTurn);
+                kernels.nativeTan(in.data(), tan.data(), n, quarterTurn);
+                kernels.nativeSincos(in.data(), sincosSin.data(), sincosCos.data(), n, quarterTurn);
+                for (std::size_t i = 0; i < n; i++) {
+                    INFO(in[i]);
+                    double expectedSin = simd::nativeSin(in[i], quarterTurn);
+                    double expectedCos = simd::nativeCos(in[i], quarterTurn);
+                    CHECK((sin[i] == expectedSin || std::isnan(expectedSin)));
+                    CHECK((cos[i] == expectedCos || std::isnan(expectedCos)));
+                    CHECK((sincosSin[i] == sin[i] || std::isnan(sin[i])));
+                    CHECK((sincosCos[i] == cos[i] || std::isnan(cos[i])));
+                    if (i < 17) {
+                        CHECK(std::fabs(sin[i]) == (i % 2 ? 1 : 0));
+                        CHECK(std::fabs(cos[i]) == (i % 2 ? 0 : 1));
+                        if (i % 2 == 0) CHECK(tan[i] == 0);
+                    }
+                }
+            }
+        });
+    }
+    SECTION("shot deltas") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            std::mt19937_64 random(3);
+            std::uniform_real_distribution<double> angles(-720, 720);
+            std::size_t n = 203;
+            std::vector<double> distance(n), azimuth(n), inclination(n);
+            for (std::size_t i = 0; i < n; i++) {
+                distance[i] = i * 0.75;
+                azimuth[i] = angles(random);
+                inclination[i] = angles(random) / 8;
+            }
+            azimuth[5] = 1e300;      // reduced by the fallback
+            inclination[9] = NAN;
+            for (double azimuthQuarterTurn : {0.0, 90.0}) {
+                for (double inclinationQuarterTurn : {0.0, 100.0}) {
+                    std::vector<double> east(n), north(n), up(n);
+                    kernels.shotDeltas(distance.data(), azimuth.data(), inclination.data(),
+                                       east.data(), north.data(), up.data(), n,
+                                       0.3048, azimuthQuarterTurn, inclinationQuarterTurn);
+                    for (std::size_t i = 0; i < n; i++) {
+                        INFO(i);
+                        double sinA, cosA, sinB, cosB;
+                        if (azimuthQuarterTurn) simd::nativeSincos(azimuth[i], azimuthQuarterTurn, sinA, cosA);
+                        else simd::sincos(azimuth[i], sinA, cosA);
+                        if (inclinationQuarterTurn) simd::nativeSincos(inclination[i], inclinationQuarterTurn, sinB, cosB);
+                        else simd::sincos(inclination[i], sinB, cosB);
+                        double d = distance[i] * 0.3048;
+                        if (std::isnan(inclination[i])) {
+                            CHECK(std::isnan(up[i]));
+                            continue;
+                        }
+                        CHECK(east[i] == Approx(d * cosB * sinA).epsilon(1e-15).margin(1e-12));
+                        CHECK(north[i] == Approx(d * cosB * cosA).epsilon(1e-15).margin(1e-12));
+                        CHECK(up[i] == Approx(d * sinB).epsilon(1e-15).margin(1e-12));
+                    }
+                }
+            }
+        });
+    }
+    SECTION("delta shots") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            std::mt19937_64 random(4);
+            std::uniform_real_distribution<double> deltas(-100, 100);
+            std::size_t n = 203;
+            std::vector<double> east(n), north(n), up(n);
+            for (std::size_t i = 0; i < n; i++) {
+                east[i] = deltas(random);
+                north[i] = deltas(random);
+                up[i] = deltas(random);
+            }
+            // lanes the sums of squares can't handle
+            east[3] = 1e300;
+            north[11] = -1e-310;
+            east[11] = up[11] = 0;
+            east[20] = north[20] = up[20] = 0;
+            up[30] = INFINITY;
+            const double degreesPerRadian = 180 / 3.14159265358979323846;
+            std::vector<double> distance(n), azimuth(n), inclination(n);
+            kernels.deltaShots(east.data(), north.data(), up.data(), distance.data(), azimuth.data(),
+                               inclination.data(), n, 2, degreesPerRadian, 1, 360);
+            for (std::size_t i = 0; i < n; i++) {
+                INFO(i);
+                double horizontal = std::hypot(east[i], north[i]);
+                double expectedAzimuth = std::atan2(east[i], north[i]) * degreesPerRadian;
+                if (expectedAzimuth < 0) expectedAzimuth += 360;
+                CHECK(distance[i] == Approx(2 * std::hypot(horizontal, up[i])).epsilon(1e-15));
+                CHECK(azimuth[i] == Approx(expectedAzimuth).epsilon(1e-14));
+                CHECK(inclination[i] == Approx(std::atan2(up[i], horizontal)).epsilon(1e-15));
+            }
+        });
+    }
+    SECTION("compensated sum") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            for (std::size_t n : {0, 1, 5, 16, 37, 10001}) {
+                INFO(n);
+                // alternating huge and tiny values defeat a naive sum
+                std::vector<double> in(n);
+                long double exact = 0.5;
+                for (std::size_t i = 0; i < n; i++) {
+                    in[i] = i % 3 == 0 ? 1e16 : i % 3 == 1 ? 1.25 : -1e16;
+                    exact += in[i];
+                }
+                double sum = 0.5, compensation = 0;
+                kernels.sum(in.data(), n, sum, compensation);
+                CHECK(sum + compensation == static_cast<double>(exact));
+            }
+        });
+    }
+
+    SECTION("compensated prefix sum") {
+        forEachIsa([](const simd::Kernels& kernels) {
+            for (std::size_t n : {0, 1, 5, 16, 37, 10001}) {
+                INFO(n);
+                std::vector<double> in(n), out(n);
+                for (std::size_t i = 0; i < n; i++) in[i] = i % 3 == 0 ? 1e16 : i % 3 == 1 ? 1.25 : -1e16;
+                // in two calls, the first ending mid-pack
+                double sum = 0.5, compensation = 0;
+                std::size_t half = n / 2;
+                kernels.prefixSum(in.data(), out.data(), half, sum, compensation, 1, 0);
+                kernels.prefixSum(in.data() + half, out.data() + half, n - half, sum, compensation, 1, 0);
+                long double exact = 0.5;
+                for (std::size_t i = 0; i < n; i++) {
+                    INFO(i);
+                    exact += in[i];
+                    CHECK(out[i] == static_cast<double>(exact));
+                }
+                CHECK(sum + compensation == static_cast<double>(exact));
+
+                // in place, scaled and offset
+                sum = compensation = 0;
+                kernels.prefixSum(in.data(), in.data(), n, sum, compensation, 0.5, 3);
+                for (std::size_t i = 0; i < n; i++) CHECK(in[i] == Approx((out[i] - 0.5) * 0.5 + 3));
+            }
+        });
+    }
+
+    SECTION("separators") {
+        std::mt19937_64 random(1);
+        std::string text;
+        for (int i = 0; i < 1000; i++) text += "0123456789,\n\t-"[random() % 14];
+        forEachIsa([&](const simd::Kernels& kernels) {
+            for (std::size_t n : {0, 1, 7, 63, 64, 65, 1000}) {
+                INFO(n);
+                std::vector<std::uint32_t> expected;
+                for (std::size_t i = 0; i < n; i++) {
+                    if (text[i] == ',' || text[i] == '\n') expected.push_back(static_cast<std::uint32_t>(i));
+                }
+                std::vector<std::uint32_t> positions(n);
+                positions.resize(kernels.findSeparators(text.data(), n, ',', positions.data()));
+                CHECK(positions == expected);
+            }
+        });
+    }
+}
+
+// Error of actual in float ulps of the exact result, rounded to float.
+double floatUlps(float actual, double exact) {
+    if (std::isnan(actual) && std::isnan(exact)) return 0;
+    float rounded = static_cast<float>(exact);
+    float ulp = std::nextafter(std::fabs(rounded), INFINITY) - std::fabs(rounded);
+    return std::fabs(actual - exact) / ulp;
+}
+
+TEST_CASE( "SIMD float kernels" , "[unitized, simd]" ) {
+    CHECK(simd::floatKernels().isa == simd::detectIsa());
+
+    auto forEachFloatIsa = [](auto check) {
+        for (simd::Isa isa : {simd::Scalar, simd::SSE2, simd::AVX2, simd::AVX512}) {
+            if (simd::isSupported(isa)) {
+                INFO("isa " << isa);
+                check(simd::floatKernels(isa));
+            }
+        }
+    };
+
+    SECTION("conversions") {
+        forEachFloatIsa([](const simd::FloatKernels& kernels) {
+            for (std::size_t n : {0, 1, 7, 16, 33, 100}) {
+                std::vector<float> in(n), out(n);
+                for (std::size_t i = 0; i < n; i++) in[i] = i * 1.5f - 20;
+                kernels.scale(in.data(), out.data(), n, 0.3048);
+                for (std::size_t i = 0; i < n; i++) {
+                    CHECK(floatUlps(out[i], in[i] * 0.3048) < 1);
+                }
+                std::vector<double> wide(n);
+                kernels.widen(in.data(), wide.data(), n, 0.3048);
+                for (std::size_t i = 0; i < n; i++) {
+                    CHECK(wide[i] == in[i] * 0.3048);
+                }
+                CHECK(kernels.narrow(wide.data(), out.data(), n, 1 / 0.3048) == 0);
+                for (std::size_t i = 0; i < n; i++) {
+                    CHECK(out[i] == static_cast<float>(wide[i] / 0.3048));
+                }
+            }
+            double in[] = {1e300, -1e39, 1e-50, 0, -0.0, INFINITY, NAN, 3e38};
+            float out[8];
+            CHECK(kernels.narrow(in, out, 8, 1) == 3);
+            CHECK(out[0] == INFINITY);
+            CHECK(out[2] == 0);
+            CHECK(out[7] == 3e38f);
+        });
+    }
+    SECTION("trigonometry") {
+        forEachFloatIsa([](const simd::FloatKernels& kernels) {
+            std::mt19937_64 random(1);
+            for (float limit : {4.0f, 8000.0f, 1e6f}) {
+                std::uniform_real_distribution<float> distribution(-limit, limit);
+                std::vector<float> in = {0, -0.0f, 1e30f, INFINITY, NAN};
+                for (int i = 0; i < 10000; i++) in.push_back(distribution(random));
+                std::vector<float> sin(in.size()), cos(in.size()), tan(in.size()), sin2(in.size()), cos2(in.size());
+                kernels.sin(in.data(), sin.data(), in.size());
+                kernels.cos(in.data(), cos.data(), in.size());
+                kernels.tan(in.data(), tan.data(), in.size());
+                kernels.sincos(in.data(), sin2.data(), cos2.data(), in.size());
+                double worstSin = 0, worstCos = 0, worstTan = 0;
+                for (std::size_t i = 0; i < in.size(); i++) {
+                    worstSin = std::max(worstSin, floatUlps(sin[i], std::sin(static_cast<double>(in[i]))));
+                    worstCos = std::max(worstCos, floatUlps(cos[i], std::cos(static_cast<double>(in[i]))));
+                    worstTan = std::max(worstTan, floatUlps(tan[i], std::tan(static_cast<double>(in[i]))));
+                    CHECK((sin2[i] == sin[i] || std::isnan(sin[i])));
+                    CHECK((cos2[i] == cos[i] || std::isnan(cos[i])));
+                }
+                CHECK(worstSin < 2.5);
+                CHECK(worstCos < 2.5);
+                CHECK(worstTan < 4);
+            }
+        });
+    }
+    SECTION("native units") {
+        forEachFloatIsa([](const simd::FloatKernels& kernels) {
+            for (float quarterTurn : {90.0f, 100.0f, 1600.0f}) {
+                INFO(quarterTurn);
+                std::vector<float> in;
+                for (int i = -8; i <= 8; i++) in.push_back(i * quarterTurn);
+                std::mt19937_64 random(1);
+                std::uniform_real_distribution<float> distribution(-8 * quarterTurn, 8 * quarterTurn);
+                for (int i = 0; i < 10000; i++) in.push_back(distribution(random));
+                in.push_back(3e6f);
+                std::vector<float> sin(in.size()), cos(in.size());
+                kernels.nativeSincos(in.data(), sin.data(), cos.data(), in.size(), quarterTurn);
+                double worst = 0;
+                for (std::size_t i = 0; i < in.size(); i++) {
+                    double s, c;
+                    simd::nativeSincos(in[i], quarterTurn, s, c);
+                    worst = std::max(worst, std::max(floatUlps(sin[i], s), floatUlps(cos[i], c)));
+                }
+                CHECK(worst < 2.5);
+                // multiples of a right angle are exact
+                for (int i = 0; i <= 16; i++) {
+                    CHECK(std::fabs(sin[i]) == std::fabs(static_cast<float>((i % 2) != 0)));
+                    CHECK(std::fabs(cos[i]) == std::fabs(static_cast<float>((i % 2) == 0)));
+                }
+            }
+        });
+    }
+}
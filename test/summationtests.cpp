@@ -0,0 +1,38 @@
+#include "catch.hpp"
+#include "../src/summation.h"
+#include <list>
+#include <vector>
+
+using namespace unitized;
+
+TEST_CASE( "Summation" , "[unitized, summation]" ) {
+    SECTION("lengths") {
+        std::vector<Length> lengths = {Length::feet(3), Length::meters(1), Length::inches(12), Length::feet(-1)};
+        Length total = sum(lengths);
+        CHECK(total.unit == Length::Feet);
+        CHECK(total.convertTo(Length::Feet) == Approx(3 + 1 / 0.3048).epsilon(1e-15));
+        CHECK(sum(lengths, Length::Meters).toMeters() == Approx(1 + 3 * 0.3048).epsilon(1e-15));
+        CHECK(mean(lengths).toFeet() == Approx((3 + 1 / 0.3048) / 4).epsilon(1e-15));
+        CHECK(sum(std::vector<Length>()).isZero());
+        CHECK(sum(std::vector<Length>()).unit == Length::Meters);
+        CHECK(mean(std::vector<Length>()).isNaN());
+    }
+    SECTION("angles") {
+        std::list<Angle> angles = {Angle::degrees(30), Angle::gradians(100), Angle::percentGrade(100)};
+        CHECK(sum(angles).toDegrees() == Approx(165).epsilon(1e-15));
+        CHECK(mean(angles, Angle::Radians).toDegrees() == Approx(55).epsilon(1e-15));
+        CHECK(sum(angles, Angle::PercentGrade).unit == Angle::PercentGrade);
+    }
+    SECTION("compensation") {
+        // a naive running sum loses every 1 against 1e16
+        std::vector<Length> lengths;
+        for (int i = 0; i < 3000; i++) {
+            lengths.push_back(Length::meters(1e16));
+            lengths.push_back(Length::meters(1));
+            lengths.push_back(Length::centimeters(100));
+            lengths.push_back(Length::meters(-1e16));
+        }
+        CHECK(sum(lengths).toMeters() == 6000);
+        CHECK(mean(lengths).toMeters() == 0.5);
+    }
+}
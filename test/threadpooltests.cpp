@@ -0,0 +1,110 @@
+#include "catch.hpp"
+#include "../src/threadpool.h"
+#include "../src/lengtharray.h"
+#include "../src/anglearray.h"
+#include "../src/traverse.h"
+#include "../src/summation.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace unitized;
+
+TEST_CASE( "ThreadPool" , "[unitized, threadpool]" ) {
+    ThreadPool pool(4);
+    CHECK(pool.size() == 4);
+    CHECK(ThreadPool::l2CacheSize() > 0);
+
+    SECTION("every chunk runs once") {
+        // reusing the pool for many batches, small and large
+        for (std::size_t n : {0, 1, 7, 100, 1000, 100003}) {
+            INFO(n);
+            std::vector<std::atomic<int>> runs(n);
+            for (auto& r : runs) r = 0;
+            // Catch's assertions aren't thread-safe, so only count in the chunks
+            std::atomic<std::size_t> largest(0);
+            pool.forEachChunk(n, 64, [&](std::size_t begin, std::size_t end) {
+                if (end - begin > largest) largest = end - begin;
+                for (std::size_t i = begin; i < end; i++) runs[i]++;
+            });
+            CHECK(largest <= 64);
+            for (std::size_t i = 0; i < n; i++) {
+                if (runs[i] != 1) FAIL(i << " ran " << runs[i] << " times");
+            }
+        }
+    }
+    SECTION("exceptions reach the caller") {
+        CHECK_THROWS_AS(pool.forEachChunk(1000, 10, [](std::size_t begin, std::size_t) {
+            if (begin == 500) throw std::runtime_error("chunk");
+        }), std::runtime_error);
+        // and the pool still works afterwards
+        std::atomic<std::size_t> total(0);
+        pool.forEachChunk(1000, 10, [&](std::size_t begin, std::size_t end) { total += end - begin; });
+        CHECK(total == 1000);
+    }
+    SECTION("policies") {
+        CHECK(!ExecutionPolicy().isParallel());
+        CHECK(!ExecutionPolicy::sequential().isParallel());
+        CHECK(ExecutionPolicy::parallel(pool).pool() == &pool);
+        CHECK(ExecutionPolicy::parallel().pool() == &ThreadPool::shared());
+        CHECK(ExecutionPolicy::sequential().chunkSize(16) % 64 == 0);
+        CHECK(ExecutionPolicy::sequential().chunkSize(1 << 30) == 1024);
+    }
+    SECTION("parallel batch operations match sequential ones") {
+        ExecutionPolicy parallel = ExecutionPolicy::parallel(pool);
+        std::size_t n = 300001;
+        std::vector<double> values(n), azimuths(n), inclinations(n);
+        for (std::size_t i = 0; i < n; i++) {
+            values[i] = 1 + (i % 1000) * 0.37;
+            azimuths[i] = (i * 7) % 360 + 0.25;
+            inclinations[i] = (i % 181) - 90.0;
+        }
+        LengthArray lengths(values, Length::Feet);
+        AngleArray angles(azimuths, Angle::Degrees);
+
+        std::vector<double> expected(n), actual(n);
+        lengths.convertTo(Length::Meters, expected.data());
+        lengths.convertTo(Length::Meters, actual.data(), parallel);
+        CHECK(actual == expected);
+        angles.convertTo(Angle::Radians, expected.data());
+        angles.convertTo(Angle::Radians, actual.data(), parallel);
+        CHECK(actual == expected);
+        AngleArray::sin(azimuths.data(), expected.data(), n, Angle::Degrees);
+        AngleArray::sin(azimuths.data(), actual.data(), n, Angle::Degrees, parallel);
+        CHECK(actual == expected);
+        std::vector<double> expectedCos(n), actualCos(n);
+        AngleArray::sincos(azimuths.data(), expected.data(), expectedCos.data(), n, Angle::Gradians);
+        AngleArray::sincos(azimuths.data(), actual.data(), actualCos.data(), n, Angle::Gradians, parallel);
+        CHECK(actual == expected);
+        CHECK(actualCos == expectedCos);
+
+        AngleArray inclination(inclinations, Angle::Degrees);
+        LengthArray east(Length::Meters), north(Length::Meters), up(Length::Meters);
+        LengthArray east2(Length::Meters), north2(Length::Meters), up2(Length::Meters);
+        Traverse::toDeltas(lengths, angles, inclination, Length::Meters, east, north, up);
+        Traverse::toDeltas(lengths, angles, inclination, Length::Meters, east2, north2, up2, parallel);
+        CHECK(east.equals(east2));
+        CHECK(north.equals(north2));
+        CHECK(up.equals(up2));
+
+        LengthArray distance(Length::Feet), distance2(Length::Feet);
+        AngleArray azimuth(Angle::Degrees), azimuth2(Angle::Degrees);
+        AngleArray inclination1(Angle::Degrees), inclination2(Angle::Degrees);
+        Traverse::fromDeltas(east, north, up, Length::Feet, Angle::Degrees, Angle::Degrees,
+                             distance, azimuth, inclination1);
+        Traverse::fromDeltas(east, north, up, Length::Feet, Angle::Degrees, Angle::Degrees,
+                             distance2, azimuth2, inclination2, parallel);
+        CHECK(distance.equals(distance2));
+        CHECK(azimuth.equals(azimuth2));
+        CHECK(inclination1.equals(inclination2));
+
+        CHECK(sum(lengths, parallel).toFeet() == Approx(sum(lengths).toFeet()).epsilon(1e-15));
+        CHECK(mean(angles, parallel).toDegrees() == Approx(mean(angles).toDegrees()).epsilon(1e-15));
+        AngleArray grades = inclination.as(Angle::PercentGrade);
+        CHECK(sum(grades, parallel).toDegrees() == Approx(sum(grades).toDegrees()).epsilon(1e-12));
+
+        LengthArray stations = Traverse::accumulate(lengths, Length::meters(0), Length::Feet);
+        LengthArray stations2 = Traverse::accumulate(lengths, Length::meters(0), Length::Feet, parallel);
+        CHECK(stations2.data()[n - 1] == Approx(stations.data()[n - 1]).epsilon(1e-15));
+    }
+}
@@ -0,0 +1,156 @@
+#include "catch.hpp"
+#include "../src/traverse.h"
+#include "../src/simd.h"
+#include <cmath>
+
+using namespace unitized;
+
+TEST_CASE( "Traverse" , "[unitized, traverse]" ) {
+    SECTION("shots to deltas") {
+        LengthArray distance({10, 25.5, 3, 0, 100, 7, 12, 1e3, 4}, Length::Feet);
+        AngleArray azimuth({0, 90, 180, 45, 359.5, -30, 1e14, 270, 12.25}, Angle::Degrees);
+        AngleArray inclination({0, 10, -90, 5, 30, 0, -12, 90, 1e20}, Angle::Degrees);
+        LengthArray east(Length::Meters), north(Length::Meters), up(Length::Meters);
+        Traverse::toDeltas(distance, azimuth, inclination, Length::Meters, east, north, up);
+        REQUIRE(east.size() == distance.size());
+        CHECK(east.unit() == Length::Meters);
+        for (std::size_t i = 0; i < distance.size(); i++) {
+            INFO(i);
+            double d = distance[i].toMeters();
+            double horizontal = d * Angle::cos(inclination[i]);
+            CHECK(east.data()[i] == Approx(horizontal * Angle::sin(azimuth[i])).epsilon(1e-15).margin(1e-300));
+            CHECK(north.data()[i] == Approx(horizontal * Angle::cos(azimuth[i])).epsilon(1e-15).margin(1e-300));
+            CHECK(up.data()[i] == Approx(d * Angle::sin(inclination[i])).epsilon(1e-15).margin(1e-300));
+        }
+        // exact reduction keeps cardinal directions exact
+        CHECK(east.data()[0] == 0);
+        CHECK(north.data()[1] == 0);
+        CHECK(east.data()[2] == 0);
+        CHECK(north.data()[2] == 0);
+        CHECK(up.data()[2] == -Length::feet(3).toMeters());
+    }
+    SECTION("any angle units") {
+        std::vector<double> azimuths = {0.1, 1, 2, 3, 4, 5, 6};
+        std::vector<double> inclinations = {-1, -0.5, 0, 0.25, 0.5, 1, 1.5};
+        std::size_t n = azimuths.size();
+        std::vector<double> distances(n, 2);
+        for (Angle::Unit azimuthUnit : {Angle::Degrees, Angle::Radians, Angle::MilsNATO, Angle::PercentGrade}) {
+            for (Angle::Unit inclinationUnit : {Angle::Gradians, Angle::Radians, Angle::PercentGrade}) {
+                INFO(azimuthUnit << " " << inclinationUnit);
+                AngleArray azimuth = AngleArray(azimuths, Angle::Radians).as(azimuthUnit);
+                AngleArray inclination = AngleArray(inclinations, Angle::Radians).as(inclinationUnit);
+                std::vector<double> east(n), north(n), up(n);
+                Traverse::toDeltas(distances.data(), Length::Yards, azimuth.data(), azimuthUnit,
+                                   inclination.data(), inclinationUnit, east.data(), north.data(), up.data(),
+                                   n, Length::Feet);
+                for (std::size_t i = 0; i < n; i++) {
+                    double horizontal = 6 * Angle::cos(inclination[i]);
+                    CHECK(east[i] == Approx(horizontal * Angle::sin(azimuth[i])).epsilon(1e-14));
+                    CHECK(north[i] == Approx(horizontal * Angle::cos(azimuth[i])).epsilon(1e-14));
+                    CHECK(up[i] == Approx(6 * Angle::sin(inclination[i])).epsilon(1e-14));
+                }
+            }
+        }
+    }
+    SECTION("deltas to shots") {
+        LengthArray east({0, 3, -0.0, -1e-300, -4, 1e200, 1, 0, 2}, Length::Meters);
+        LengthArray north({5, 4, 2, 1, 0, 1e200, -1e-20, 0, 2}, Length::Meters);
+        LengthArray up({0, 12, -2, 0, 3, 0, 0, 0, 1}, Length::Meters);
+        LengthArray distance(Length::Meters);
+        AngleArray azimuth(Angle::Degrees), inclination(Angle::Degrees);
+        Traverse::fromDeltas(east, north, up, Length::Feet, Angle::Degrees, Angle::Gradians,
+                             distance, azimuth, inclination);
+        REQUIRE(distance.size() == east.size());
+        CHECK(distance.unit() == Length::Feet);
+        CHECK(azimuth.unit() == Angle::Degrees);
+        CHECK(inclination.unit() == Angle::Gradians);
+        for (std::size_t i = 0; i < east.size(); i++) {
+            INFO(i);
+            double e = east.data()[i], n = north.data()[i], u = up.data()[i];
+            double horizontal = std::hypot(e, n);
+            CHECK(distance[i].toMeters() == Approx(std::hypot(horizontal, u)).epsilon(1e-15));
+            CHECK(inclination[i].toRadians() == Approx(std::atan2(u, horizontal)).epsilon(1e-15));
+            CHECK(azimuth.data()[i] >= 0);
+            CHECK(azimuth.data()[i] < 360);
+            CHECK(!std::signbit(azimuth.data()[i]));
+        }
+        CHECK(distance.data()[1] == Approx(13 / 0.3048).epsilon(1e-15));
+        CHECK(azimuth.data()[0] == 0);
+        CHECK(azimuth.data()[2] == 0);
+        CHECK(azimuth.data()[3] == 0);           // just below 360 wraps to 0
+        CHECK(azimuth.data()[4] == Approx(270).epsilon(1e-15));
+        CHECK(azimuth.data()[5] == Approx(45).epsilon(1e-15));
+        CHECK(azimuth.data()[6] == Approx(90).epsilon(1e-15));
+        CHECK(distance.data()[7] == 0);
+        CHECK(inclination.data()[7] == 0);
+        CHECK(inclination.data()[2] == Approx(-50).epsilon(1e-15));
+
+        // vertical shots, which the vector path sees with whole packs
+        std::vector<double> zeros(16, 0.0), ups(16, -3.0), d(16), a(16, NAN), b(16);
+        Traverse::fromDeltas(zeros.data(), zeros.data(), ups.data(), Length::Meters, d.data(), Length::Meters,
+                             a.data(), Angle::Degrees, b.data(), Angle::Degrees, 16);
+        for (std::size_t i = 0; i < 16; i++) {
+            CHECK(d[i] == 3);
+            CHECK(a[i] == 0);
+            CHECK(b[i] == -90);
+        }
+    }
+    SECTION("round trip") {
+        std::size_t n = 101;
+        std::vector<double> distances(n), azimuths(n), inclinations(n);
+        for (std::size_t i = 0; i < n; i++) {
+            distances[i] = 1 + i * 3.5;
+            azimuths[i] = i * 3.55;
+            inclinations[i] = -88 + i * 1.7;
+        }
+        for (Angle::Unit unit : {Angle::Degrees, Angle::Radians, Angle::MilsNATO, Angle::PercentGrade}) {
+            INFO(unit);
+            // a grade only tells azimuths apart modulo 180 degrees
+            Angle::Unit azimuthUnit = unit == Angle::PercentGrade ? Angle::Gradians : unit;
+            LengthArray distance(distances, Length::Feet);
+            AngleArray azimuth = AngleArray(azimuths, Angle::Degrees).as(azimuthUnit);
+            AngleArray inclination = AngleArray(inclinations, Angle::Degrees).as(unit);
+            LengthArray east(Length::Meters), north(Length::Meters), up(Length::Meters);
+            Traverse::toDeltas(distance, azimuth, inclination, Length::Meters, east, north, up);
+            LengthArray distance2(Length::Feet);
+            AngleArray azimuth2(unit), inclination2(unit);
+            Traverse::fromDeltas(east, north.as(Length::Yards), up, Length::Feet, azimuthUnit, unit,
+                                 distance2, azimuth2, inclination2);
+            for (std::size_t i = 0; i < n; i++) {
+                CHECK(distance2.data()[i] == Approx(distances[i]).epsilon(1e-14));
+                CHECK(azimuth2[i].toDegrees() == Approx(azimuths[i]).epsilon(1e-12).margin(1e-12));
+                CHECK(inclination2[i].toDegrees() == Approx(inclinations[i]).epsilon(1e-12).margin(1e-12));
+            }
+        }
+    }
+    SECTION("accumulate") {
+        LengthArray deltas({1, 2, -0.5, 10}, Length::Feet);
+        LengthArray stations = Traverse::accumulate(deltas, Length::meters(100), Length::Meters);
+        CHECK(stations.unit() == Length::Meters);
+        REQUIRE(stations.size() == 4);
+        CHECK(stations.data()[0] == Approx(100.3048).epsilon(1e-15));
+        CHECK(stations.data()[3] == Approx(100 + 12.5 * 0.3048).epsilon(1e-15));
+        CHECK(Traverse::accumulate(LengthArray(Length::Feet), Length::meters(0), Length::Meters).empty());
+    }
+    SECTION("accumulate in parallel without drift") {
+        // enough shots for several blocks, with deltas a naive sum rounds badly
+        std::size_t n = 1000003;
+        std::vector<double> deltas(n);
+        for (std::size_t i = 0; i < n; i++) deltas[i] = i % 2 ? 0.1 : 1e8 + 0.1;
+        std::vector<double> stations(n);
+        ThreadPool pool(3);
+        Traverse::accumulate(deltas.data(), Length::Meters, stations.data(), n, Length::meters(0), Length::Meters,
+                             ExecutionPolicy::parallel(pool));
+        for (std::size_t i = 0; i < n; i += 9973) {
+            INFO(i);
+            // 0.1 and 1e8 + 0.1 aren't exact in binary, so compare with the
+            // doubles actually stored
+            long double exact = (i / 2 + 1) * static_cast<long double>(1e8 + 0.1) + ((i + 1) / 2) * static_cast<long double>(0.1);
+            CHECK(std::fabs(stations[i] - static_cast<double>(exact)) <= std::fabs(stations[i]) * 2e-16);
+        }
+        std::vector<double> serial(n);
+        double sum = 0, compensation = 0;
+        simd::kernels().prefixSum(deltas.data(), serial.data(), n, sum, compensation, 1, 0);
+        CHECK(stations.back() == Approx(serial.back()).epsilon(1e-15));
+    }
+}